@@ -0,0 +1,83 @@
+#ifndef __ALIGNED_ALLOCATOR_HPP__
+#define __ALIGNED_ALLOCATOR_HPP__
+
+#include "AllocatorTraits.hpp"
+
+#include <cstddef>
+
+/// Stateless allocator whose blocks start on an Alignment boundary, for
+/// aligned SIMD loads over a Vector's buffer. With PadToLine every block
+/// also starts and ends on a cache line (or on Alignment if that is
+/// larger), so two buffers never share a line; its AllocatorTraits report
+/// the padding as capacity.
+template <typename T, std::size_t Alignment = 64, bool PadToLine = true>
+class AlignedAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static const std::size_t CACHE_LINE = 64;
+    static const std::size_t BLOCK_ALIGNMENT = (PadToLine && Alignment < CACHE_LINE) ? CACHE_LINE : Alignment;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef AlignedAllocator<U, Alignment, PadToLine> other;
+    };
+
+    AlignedAllocator();
+    AlignedAllocator(const AlignedAllocator& rhv);
+    template <typename U> AlignedAllocator(const AlignedAllocator<U, Alignment, PadToLine>& rhv);
+    ~AlignedAllocator();
+
+    pointer allocate(const size_type n, const void* hint = 0);
+    void deallocate(pointer p, const size_type n);
+    size_type max_size() const;
+    void construct(pointer p, const_reference value);
+    void destroy(pointer p);
+    pointer address(reference r) const;
+    const_pointer address(const_reference r) const;
+
+    static std::size_t blockBytes(const size_type n);
+
+private:
+    typedef char AlignmentIsPowerOfTwo[0 == (Alignment & (Alignment - 1)) && Alignment >= sizeof(void*) ? 1 : -1];
+};
+
+template <typename T, typename U, std::size_t Alignment, bool PadToLine>
+bool operator==(const AlignedAllocator<T, Alignment, PadToLine>& lhv, const AlignedAllocator<U, Alignment, PadToLine>& rhv);
+template <typename T, typename U, std::size_t Alignment, bool PadToLine>
+bool operator!=(const AlignedAllocator<T, Alignment, PadToLine>& lhv, const AlignedAllocator<U, Alignment, PadToLine>& rhv);
+
+/// realloc() does not keep the alignment, so reallocate() never helps.
+template <typename T, std::size_t Alignment, bool PadToLine>
+struct AllocatorTraits<AlignedAllocator<T, Alignment, PadToLine> >
+{
+    typedef AlignedAllocator<T, Alignment, PadToLine> Allocator;
+    typedef typename Allocator::pointer pointer;
+    typedef typename Allocator::const_pointer const_pointer;
+    typedef typename Allocator::size_type size_type;
+    static const bool ALWAYS_TRANSFERABLE = true;
+
+    static pointer allocateAtLeast(Allocator& allocator, const size_type n, size_type& allocated);
+    static pointer reallocate(Allocator& allocator, pointer p, const size_type capacity, const size_type n, size_type& allocated);
+    static bool isTransferable(const Allocator& allocator, const_pointer p);
+};
+
+#if __cplusplus >= 201103L
+template <typename T, typename Alloc, typename Growth> class Vector;
+struct DoublingGrowth;
+
+template <typename T, std::size_t Alignment = 64, bool PadToLine = true, typename Growth = DoublingGrowth>
+using AlignedVector = Vector<T, AlignedAllocator<T, Alignment, PadToLine>, Growth>;
+#endif
+
+#include "../templates/AlignedAllocator.cpp"
+
+#endif /// __ALIGNED_ALLOCATOR_HPP__
@@ -0,0 +1,33 @@
+#ifndef __ALLOCATOR_TRAITS_HPP__
+#define __ALLOCATOR_TRAITS_HPP__
+
+/// Optional allocator capabilities used by Vector. The primary template
+/// maps everything onto the plain allocator interface; allocators that
+/// can do better specialize it next to their own definition.
+template <typename Alloc>
+struct AllocatorTraits
+{
+    typedef typename Alloc::pointer pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+    typedef typename Alloc::size_type size_type;
+
+    /// Whether isTransferable() holds for every buffer, which makes moving
+    /// and swapping the owning containers unable to throw.
+    static const bool ALWAYS_TRANSFERABLE = true;
+
+    /// Allocates room for at least n elements and stores the number of
+    /// usable elements, including any slack, in allocated.
+    static pointer allocateAtLeast(Alloc& allocator, const size_type n, size_type& allocated);
+    /// Grows buffer p of capacity elements to at least n elements in place
+    /// or by moving its bytes, and returns the new buffer. Returns NULL,
+    /// leaving p untouched, when the allocator cannot do better than a
+    /// fresh allocation. Only used for trivially relocatable elements.
+    static pointer reallocate(Alloc& allocator, pointer p, const size_type capacity, const size_type n, size_type& allocated);
+    /// Whether buffer p may change owner by swapping or moving the owning
+    /// containers. False for memory that lives inside the allocator itself.
+    static bool isTransferable(const Alloc& allocator, const_pointer p);
+};
+
+#include "../templates/AllocatorTraits.cpp"
+
+#endif /// __ALLOCATOR_TRAITS_HPP__
@@ -0,0 +1,87 @@
+#ifndef __ARENA_ALLOCATOR_HPP__
+#define __ARENA_ALLOCATOR_HPP__
+
+#include <cstddef>
+
+/// Bump-pointer (monotonic) memory arena. Memory handed out is only given
+/// back all at once through release() or the destructor; deallocate() only
+/// rolls the bump pointer back when the freed block is the most recent one,
+/// which covers the common "Vector grows in place of its last buffer" case.
+class Arena
+{
+public:
+    static const std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    explicit Arena(const std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~Arena();
+    void* allocate(const std::size_t bytes, const std::size_t alignment);
+    void deallocate(void* ptr, const std::size_t bytes);
+    void release();
+    std::size_t bytesAllocated() const;
+    std::size_t blockCount() const;
+
+private:
+    Arena(const Arena& rhv);
+    Arena& operator=(const Arena& rhv);
+    void grow(const std::size_t bytes, const std::size_t alignment);
+
+private:
+    struct Block
+    {
+        Block* next;
+        std::size_t size;
+    };
+
+    Block* blocks_;
+    char* current_;
+    char* limit_;
+    std::size_t blockSize_;
+    std::size_t bytesAllocated_;
+};
+
+/// Standard allocator interface over an Arena. Copies share the arena, so
+/// every Vector built from the same allocator is freed by one release().
+template <typename T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef ArenaAllocator<U> other;
+    };
+
+    explicit ArenaAllocator(Arena& arena);
+    ArenaAllocator(const ArenaAllocator& rhv);
+    template <typename U> ArenaAllocator(const ArenaAllocator<U>& rhv);
+    ~ArenaAllocator();
+
+    pointer allocate(const size_type n, const void* hint = 0);
+    void deallocate(pointer p, const size_type n);
+    size_type max_size() const;
+    void construct(pointer p, const_reference value);
+    void destroy(pointer p);
+    pointer address(reference r) const;
+    const_pointer address(const_reference r) const;
+    Arena* arena() const;
+
+private:
+    Arena* arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhv, const ArenaAllocator<U>& rhv);
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhv, const ArenaAllocator<U>& rhv);
+
+#include "../templates/ArenaAllocator.cpp"
+
+#endif /// __ARENA_ALLOCATOR_HPP__
@@ -0,0 +1,211 @@
+#ifndef __BIT_VECTOR_HPP__
+#define __BIT_VECTOR_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <iterator>
+
+/// Vector<bool> packs 64 flags into each word of a Vector of words over the
+/// rebound allocator; the bits past size() are kept zero. Elements are
+/// reached through proxy references. count, find_first / find_next, the
+/// bitwise operators, resize, push_back, insert and erase work a whole word
+/// at a time.
+template <typename Alloc, typename Growth>
+class Vector<bool, Alloc, Growth>
+{
+public:
+    typedef unsigned long long word_type;
+    typedef typename Alloc::template rebind<word_type>::other word_allocator_type;
+    typedef Vector<word_type, word_allocator_type, Growth> storage_type;
+    typedef bool value_type;
+    typedef Alloc allocator_type;
+    typedef Growth growth_policy;
+    typedef bool const_reference;
+    typedef std::ptrdiff_t difference_type;
+    typedef std::size_t size_type;
+
+    static const size_type WORD_BITS = 64;
+    /// Returned by find_first and find_next when there is no set bit.
+    static const size_type npos = static_cast<size_type>(-1);
+
+    class iterator;
+
+    class reference
+    {
+        friend class Vector<bool, Alloc, Growth>;
+        friend class iterator;
+    public:
+        operator bool() const;
+        reference& operator=(const bool value);
+        reference& operator=(const reference& rhv);
+        bool operator~() const;
+        void flip();
+
+    private:
+        reference(word_type* word, const word_type mask);
+
+        word_type* word_;
+        word_type mask_;
+    };
+
+    class const_iterator
+    {
+        friend class Vector<bool, Alloc, Growth>;
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef bool value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef bool reference;
+
+        const_iterator();
+
+        bool operator*() const;
+        bool operator[](const difference_type n) const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        const_iterator& operator--();
+        const_iterator operator--(int);
+        const_iterator& operator+=(const difference_type n);
+        const_iterator& operator-=(const difference_type n);
+        const_iterator operator+(const difference_type n) const;
+        const_iterator operator-(const difference_type n) const;
+        difference_type operator-(const const_iterator& rhv) const;
+        bool operator==(const const_iterator& rhv) const;
+        bool operator!=(const const_iterator& rhv) const;
+        bool operator<(const const_iterator& rhv) const;
+        bool operator<=(const const_iterator& rhv) const;
+        bool operator>(const const_iterator& rhv) const;
+        bool operator>=(const const_iterator& rhv) const;
+
+    protected:
+        const_iterator(word_type* words, const size_type index);
+
+        word_type* words_;
+        size_type index_;
+    };
+
+    class iterator : public const_iterator
+    {
+        friend class Vector<bool, Alloc, Growth>;
+    public:
+        typedef typename Vector<bool, Alloc, Growth>::reference reference;
+
+        iterator();
+
+        reference operator*() const;
+        reference operator[](const difference_type n) const;
+        iterator& operator++();
+        iterator operator++(int);
+        iterator& operator--();
+        iterator operator--(int);
+        iterator& operator+=(const difference_type n);
+        iterator& operator-=(const difference_type n);
+        iterator operator+(const difference_type n) const;
+        using const_iterator::operator-;
+        iterator operator-(const difference_type n) const;
+
+    protected:
+        iterator(word_type* words, const size_type index);
+    };
+
+    Vector();
+    explicit Vector(const Alloc& allocator);
+    Vector(const size_type n, const bool value = false, const Alloc& allocator = Alloc());
+    Vector(const int n, const bool value, const Alloc& allocator = Alloc());
+    template <typename InputIterator> Vector(InputIterator f, InputIterator l, const Alloc& allocator = Alloc());
+    Vector(const Vector& rhv);
+    Vector& operator=(const Vector& rhv);
+#if __cplusplus >= 201103L
+    Vector(Vector&& rhv) noexcept(AllocatorTraits<word_allocator_type>::ALWAYS_TRANSFERABLE);
+    Vector& operator=(Vector&& rhv) noexcept(AllocatorTraits<word_allocator_type>::ALWAYS_TRANSFERABLE);
+#endif
+    void swap(Vector& rhv) VECTOR_NOEXCEPT_IF(AllocatorTraits<word_allocator_type>::ALWAYS_TRANSFERABLE);
+    allocator_type get_allocator() const;
+    size_type size() const;
+    bool empty() const;
+    size_type max_size() const;
+    size_type capacity() const;
+    void reserve(const size_type n);
+    void shrink_to_fit();
+    void resize(const size_type n, const bool value = false);
+    void push_back(const bool value);
+    void pop_back();
+    void clear();
+
+    bool operator[](const size_type index) const;
+    reference operator[](const size_type index);
+    bool front() const;
+    bool back() const;
+    const_iterator begin() const;
+    iterator begin();
+    const_iterator end() const;
+    iterator end();
+    /// The packed words; bits past size() are zero.
+    const storage_type& storage() const;
+
+    iterator insert(iterator pos, const bool value);
+    void insert(iterator pos, const size_type n, const bool value);
+    void insert(iterator pos, const int n, const bool value);
+    template <typename InputIterator> void insert(iterator pos, InputIterator f, InputIterator l);
+    iterator erase(iterator pos);
+    iterator erase(iterator f, iterator l);
+
+    /// Number of set bits.
+    size_type count() const;
+    bool any() const;
+    bool none() const;
+    bool all() const;
+    size_type find_first() const;
+    /// First set bit after index.
+    size_type find_next(const size_type index) const;
+    void set(const size_type first, const size_type last, const bool value = true);
+    void flip();
+
+    /// The operands must have the same size.
+    Vector& operator&=(const Vector& rhv);
+    Vector& operator|=(const Vector& rhv);
+    Vector& operator^=(const Vector& rhv);
+    Vector operator~() const;
+    bool operator==(const Vector& rhv) const;
+    bool operator!=(const Vector& rhv) const;
+
+private:
+    static size_type wordsFor(const size_type bits);
+    static word_type bitMask(const size_type index);
+    /// The bits below position within its word.
+    static word_type lowMask(const size_type position);
+
+    word_type* words();
+    const word_type* words() const;
+    void clearTail();
+    void truncate(const size_type n);
+    void openGap(const size_type index, const size_type n);
+    void closeGap(const size_type index, const size_type n);
+    void orBits(const size_type index, const Vector& bits);
+    size_type findFrom(const size_type position) const;
+    template <typename Integer>
+    void initialize(Integer n, Integer value, TrueType);
+    template <typename InputIterator>
+    void initialize(InputIterator f, InputIterator l, FalseType);
+    template <typename Integer>
+    void rangeInsert(const size_type index, Integer n, Integer value, TrueType);
+    template <typename InputIterator>
+    void rangeInsert(const size_type index, InputIterator f, InputIterator l, FalseType);
+
+private:
+    storage_type words_;
+    size_type size_;
+};
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth> operator&(const Vector<bool, Alloc, Growth>& lhv, const Vector<bool, Alloc, Growth>& rhv);
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth> operator|(const Vector<bool, Alloc, Growth>& lhv, const Vector<bool, Alloc, Growth>& rhv);
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth> operator^(const Vector<bool, Alloc, Growth>& lhv, const Vector<bool, Alloc, Growth>& rhv);
+
+#include "../templates/BitVector.cpp"
+
+#endif /// __BIT_VECTOR_HPP__
@@ -0,0 +1,114 @@
+#ifndef __CONCURRENT_VECTOR_HPP__
+#define __CONCURRENT_VECTOR_HPP__
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+/// Append-only vector that any number of threads may push_back into and
+/// read from at the same time, without locks. Elements live in segments
+/// of FIRST_SEGMENT, FIRST_SEGMENT, 2 * FIRST_SEGMENT, 4 * FIRST_SEGMENT,
+/// ... elements that are never moved, so references stay valid until
+/// clear() or destruction. size() only counts the prefix of slots that are
+/// settled, so everything below it may be read.
+///
+/// push_back makes sure the segment of the next slot exists, claims the
+/// slot with a compare-and-swap, builds the element and marks it ready; the
+/// first writer to reach a missing segment allocates it while the others
+/// wait. Every writer then advances the published size over the settled
+/// prefix. A failed segment allocation claims nothing and is retried by the
+/// next writer that needs the segment. When T's copy constructor throws the
+/// slot is marked failed instead: it still counts in size(), but iteration
+/// skips it and its index, which push_back never returned, must not be read.
+/// clear(), reserve() and destruction must not run concurrently with
+/// anything else. The allocator must be thread-safe.
+template <typename T, typename Alloc = std::allocator<T> >
+class ConcurrentVector
+{
+public:
+    typedef T value_type;
+    typedef Alloc allocator_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static const size_type FIRST_SEGMENT_BITS = 3;
+    static const size_type FIRST_SEGMENT = size_type(1) << FIRST_SEGMENT_BITS;
+    static const size_type MAX_SEGMENTS = 64;
+
+    class const_iterator
+    {
+        friend class ConcurrentVector<T, Alloc>;
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        const_iterator();
+        const_reference operator*() const;
+        const T* operator->() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        const_iterator& operator--();
+        /// Iterators are equal when only failed slots lie between them.
+        bool operator==(const const_iterator& rhv) const;
+        bool operator!=(const const_iterator& rhv) const;
+
+    private:
+        const_iterator(const ConcurrentVector* vector, const size_type index);
+
+    private:
+        const ConcurrentVector* vector_;
+        size_type index_;
+    };
+
+    explicit ConcurrentVector(const Alloc& allocator = Alloc());
+    ~ConcurrentVector();
+    /// Returns the index of the new element.
+    size_type push_back(const_reference element);
+    size_type size() const;
+    bool empty() const;
+    size_type capacity() const;
+    /// Allocates the segments up to n elements in advance.
+    void reserve(const size_type n);
+    void clear();
+    reference operator[](const size_type index);
+    const_reference operator[](const size_type index) const;
+    /// [begin(), end()) covers the elements published when end() is called,
+    /// without the failed slots.
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    static size_type segmentOf(const size_type index);
+    static size_type segmentBase(const size_type segment);
+    static size_type segmentSize(const size_type segment);
+
+private:
+    ConcurrentVector(const ConcurrentVector& rhv);
+    ConcurrentVector& operator=(const ConcurrentVector& rhv);
+    T* segment(const size_type k);
+    static T* busy();
+    char* readyFlags(const size_type k) const;
+    bool failed(const size_type index) const;
+    size_type skipFailed(size_type index) const;
+    void advancePublished();
+
+private:
+    /// States of a slot in its segment's flags.
+    enum { PENDING = 0, READY = 1, FAILED = 2 };
+
+    typedef typename Alloc::template rebind<char>::other FlagAllocator;
+
+    T* segments_[MAX_SEGMENTS];
+    char* ready_[MAX_SEGMENTS];
+    size_type claimed_;
+    size_type published_;
+    Alloc allocator_;
+};
+
+#include "../templates/ConcurrentVector.cpp"
+
+#endif /// __CONCURRENT_VECTOR_HPP__
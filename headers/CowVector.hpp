@@ -0,0 +1,113 @@
+#ifndef __COW_VECTOR_HPP__
+#define __COW_VECTOR_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <memory>
+
+/// Copy-on-write handle over a Vector. Copies share one buffer through an
+/// atomic reference count; the first mutation through a handle whose
+/// buffer is shared (push_back, insert, erase, resize, a non-const begin()
+/// or end(), ...) copies the elements into a buffer of its own first.
+/// Since the pointers a non-const begin() or end(), insert() or erase()
+/// hands out may be written through later, that buffer is no longer shared:
+/// copies of the handle copy its elements at once.
+/// Reads go through a cached element pointer, so they cost what reading a
+/// Vector does. Like std::shared_ptr, distinct handles may be used from
+/// different threads; one handle may not.
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
+class CowVector
+{
+public:
+    typedef Vector<T, Alloc, Growth> vector_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    CowVector();
+    explicit CowVector(const vector_type& elements);
+    explicit CowVector(const size_type n, const_reference value = T());
+    template <typename InputIterator> CowVector(InputIterator f, InputIterator l);
+    CowVector(const CowVector& rhv);
+    ~CowVector();
+    CowVector& operator=(const CowVector& rhv);
+    void swap(CowVector& rhv);
+
+    size_type size() const;
+    bool empty() const;
+    size_type capacity() const;
+    const_reference operator[](const size_type index) const;
+    const_reference front() const;
+    const_reference back() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    /// Detach and mark the buffer unshareable, so the returned pointers may
+    /// be written through.
+    iterator begin();
+    iterator end();
+    const vector_type& vector() const;
+    /// Number of handles sharing the buffer (0 for an empty handle).
+    size_type useCount() const;
+    bool operator==(const CowVector& rhv) const;
+    bool operator!=(const CowVector& rhv) const;
+
+    void push_back(const_reference element);
+    void pop_back();
+    iterator insert(const_iterator pos, const_reference x);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator f, const_iterator l);
+    void resize(const size_type n, const_reference init = T());
+    void reserve(const size_type n);
+    void clear();
+
+private:
+    struct Shared
+    {
+        explicit Shared(const vector_type& source);
+        Shared(const size_type n, const_reference value);
+        template <typename InputIterator> Shared(InputIterator f, InputIterator l);
+
+        unsigned long references;
+        /// Set once writable pointers into elements were handed out.
+        bool unshareable;
+        vector_type elements;
+    };
+
+    /// Drops one reference to shared when it goes out of scope.
+    class Releaser
+    {
+    public:
+        explicit Releaser(Shared* shared);
+        ~Releaser();
+
+    private:
+        Releaser(const Releaser& rhv);
+        Releaser& operator=(const Releaser& rhv);
+
+        Shared* shared_;
+    };
+
+    Shared* detach();
+    void refresh();
+    static void release(Shared* shared);
+
+private:
+    Shared* shared_;
+    T* begin_;
+    T* end_;
+};
+
+template <typename T, typename Alloc, typename Growth>
+void swap(CowVector<T, Alloc, Growth>& lhv, CowVector<T, Alloc, Growth>& rhv);
+
+#include "../templates/CowVector.cpp"
+
+#endif /// __COW_VECTOR_HPP__
@@ -0,0 +1,159 @@
+#ifndef __FLAT_MAP_HPP__
+#define __FLAT_MAP_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+/// lower_bound over [first, first + n) without data-dependent branches: the
+/// range halves every step and the comparison only selects the base, which
+/// compiles to a conditional move.
+template <typename Value, typename Key, typename KeyOf, typename Compare>
+const Value* branchlessLowerBound(const Value* first, std::size_t n, const Key& key, const KeyOf& keyOf, const Compare& less);
+template <typename Value, typename Key, typename KeyOf, typename Compare>
+const Value* branchlessUpperBound(const Value* first, std::size_t n, const Key& key, const KeyOf& keyOf, const Compare& less);
+
+template <typename K>
+struct FlatSetKey
+{
+    typedef K key_type;
+    const K& operator()(const K& value) const;
+};
+
+template <typename K, typename V>
+struct FlatMapKey
+{
+    typedef K key_type;
+    const K& operator()(const std::pair<K, V>& value) const;
+};
+
+/// Values kept sorted by key and unique in a Vector. Ranges are inserted
+/// as a batch: appended, sorted, merged and deduplicated in one pass, with
+/// the earlier of two equal keys kept. Lookups use branchlessLowerBound.
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+class FlatTable
+{
+public:
+    typedef typename KeyOf::key_type key_type;
+    typedef Value value_type;
+    typedef KeyOf key_of;
+    typedef Compare key_compare;
+    typedef Vector<Value, Alloc> storage_type;
+    typedef std::size_t size_type;
+    typedef const Value* const_iterator;
+
+    explicit FlatTable(const Compare& less = Compare());
+    template <typename InputIterator>
+    FlatTable(InputIterator f, InputIterator l, const Compare& less = Compare());
+
+    size_type size() const;
+    bool empty() const;
+    void reserve(const size_type n);
+    void clear();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const storage_type& storage() const;
+    key_compare key_comp() const;
+
+    std::pair<const_iterator, bool> insert(const value_type& value);
+    template <typename InputIterator> void insert(InputIterator f, InputIterator l);
+    size_type erase(const key_type& key);
+
+    const_iterator find(const key_type& key) const;
+    size_type count(const key_type& key) const;
+    bool contains(const key_type& key) const;
+    const_iterator lower_bound(const key_type& key) const;
+    const_iterator upper_bound(const key_type& key) const;
+
+protected:
+    Value* data();
+    bool equivalent(const key_type& lhv, const key_type& rhv) const;
+
+private:
+    /// Orders values by key; for the sorting and merging algorithms.
+    struct ValueLess
+    {
+        explicit ValueLess(const Compare& less);
+        bool operator()(const Value& lhv, const Value& rhv) const;
+        Compare less;
+    };
+
+    storage_type values_;
+    Compare less_;
+};
+
+template <typename K, typename Compare = std::less<K>, typename Alloc = std::allocator<K> >
+class FlatSet : public FlatTable<K, FlatSetKey<K>, Compare, Alloc>
+{
+    typedef FlatTable<K, FlatSetKey<K>, Compare, Alloc> Base;
+public:
+    explicit FlatSet(const Compare& less = Compare());
+    template <typename InputIterator>
+    FlatSet(InputIterator f, InputIterator l, const Compare& less = Compare());
+};
+
+/// Values are mutable through find(), at() and operator[]; keys must not
+/// be changed through them.
+template <typename K, typename V, typename Compare = std::less<K>, typename Alloc = std::allocator<std::pair<K, V> > >
+class FlatMap : public FlatTable<std::pair<K, V>, FlatMapKey<K, V>, Compare, Alloc>
+{
+    typedef FlatTable<std::pair<K, V>, FlatMapKey<K, V>, Compare, Alloc> Base;
+public:
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef std::pair<K, V> value_type;
+    typedef value_type* iterator;
+
+    explicit FlatMap(const Compare& less = Compare());
+    template <typename InputIterator>
+    FlatMap(InputIterator f, InputIterator l, const Compare& less = Compare());
+
+    using Base::find;
+    iterator find(const key_type& key);
+    /// Inserts a value-initialized V when key is missing.
+    mapped_type& operator[](const key_type& key);
+    /// Throw std::out_of_range when key is missing.
+    mapped_type& at(const key_type& key);
+    const mapped_type& at(const key_type& key) const;
+};
+
+/// Read-only copy of a FlatTable in Eytzinger (breadth-first) order: the
+/// children of slot k are 2k and 2k + 1, so a search walks the array front
+/// to back and the slots a few levels down share cache lines that are
+/// prefetched ahead of the comparisons.
+template <typename Table>
+class EytzingerLayout
+{
+public:
+    typedef typename Table::key_type key_type;
+    typedef typename Table::value_type value_type;
+    typedef typename Table::key_of key_of;
+    typedef typename Table::key_compare key_compare;
+    typedef std::size_t size_type;
+
+    /// Slots the search prefetches ahead: one cache line of descendants.
+    static const size_type PREFETCH_STRIDE = (sizeof(value_type) < 64) ? 64 / sizeof(value_type) : 1;
+
+    explicit EytzingerLayout(const Table& table);
+
+    size_type size() const;
+    /// NULL when no value has a key not less than key.
+    const value_type* lower_bound(const key_type& key) const;
+    /// NULL when key is missing.
+    const value_type* find(const key_type& key) const;
+
+private:
+    size_type fill(const value_type* sorted, size_type next, const size_type slot);
+
+    /// Slot 0 is unused, so the root is slot 1.
+    Vector<value_type> layout_;
+    size_type size_;
+    key_compare less_;
+};
+
+#include "../templates/FlatMap.cpp"
+
+#endif /// __FLAT_MAP_HPP__
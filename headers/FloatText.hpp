@@ -0,0 +1,29 @@
+#ifndef __FLOAT_TEXT_HPP__
+#define __FLOAT_TEXT_HPP__
+
+#include <cstddef>
+
+/// Locale-independent conversions between floating point values and decimal
+/// text. format() writes the shortest digits that read back to the same
+/// value (Schubfach) in fixed or scientific notation, whichever is shorter,
+/// as std::to_chars does. parse() reads in place and rounds correctly: short
+/// exact inputs are converted with one floating point operation, the rest
+/// with Eisel-Lemire, and the rare inputs too long for it to decide with an
+/// exact big-integer comparison.
+class FloatText
+{
+public:
+    /// Room for any value of either type, sign included.
+    static const std::size_t MAX_SIZE = 32;
+
+    /// Writes value at out and returns the end of the text.
+    static char* format(const double value, char* out);
+    static char* format(const float value, char* out);
+    /// Reads [+-]digits[.digits][(e|E)[+-]digits], or "inf", "infinity" or
+    /// "nan" in any case, at first. Returns the end of the number, or NULL
+    /// when there is none or it is too large for the type.
+    static const char* parse(const char* first, const char* last, double& value);
+    static const char* parse(const char* first, const char* last, float& value);
+};
+
+#endif /// __FLOAT_TEXT_HPP__
@@ -0,0 +1,67 @@
+#ifndef __GROWTH_POLICY_HPP__
+#define __GROWTH_POLICY_HPP__
+
+#include <cstddef>
+
+/// Growth policies decide the capacity Vector asks for when it runs out of
+/// room. grow() gets the current capacity, the capacity that is strictly
+/// required and sizeof(T); Vector never uses less than required. All
+/// policies are integer-only.
+///
+/// shrink() gets the capacity, the size left after an element was removed
+/// and sizeof(T), and returns the capacity to move down to; returning the
+/// capacity keeps the buffer.
+
+/// Never gives memory back; the growth policies below derive from it.
+struct NeverShrink
+{
+    static std::size_t shrink(const std::size_t capacity, const std::size_t size, const std::size_t elementSize);
+};
+
+/// 0, 1, 2, 4, 8, ...
+struct DoublingGrowth : NeverShrink
+{
+    static std::size_t grow(const std::size_t capacity, const std::size_t required, const std::size_t elementSize);
+};
+
+/// 1, 2, 3, 4, 6, 9, 13, ... A factor below the golden ratio lets a
+/// first-fit allocator reuse the sum of previously freed buffers.
+struct OneAndHalfGrowth : NeverShrink
+{
+    static std::size_t grow(const std::size_t capacity, const std::size_t required, const std::size_t elementSize);
+};
+
+/// 1.5x growth rounded up to whole pages once the buffer spans a page, so
+/// large buffers never leave a partially used page at their end.
+template <std::size_t PageSize = 4096>
+struct PageGrowth : NeverShrink
+{
+    static std::size_t grow(const std::size_t capacity, const std::size_t required, const std::size_t elementSize);
+};
+
+/// 1.5x growth rounded up to the next malloc size class (four classes per
+/// power of two, as in jemalloc and tcmalloc), so the bytes the allocator
+/// would round up to anyway become usable capacity.
+struct SizeClassGrowth : NeverShrink
+{
+    static std::size_t grow(const std::size_t capacity, const std::size_t required, const std::size_t elementSize);
+    static std::size_t sizeClass(const std::size_t bytes);
+};
+
+/// Grows like Base. Once the size drops below capacity / Fraction, and the
+/// buffer is larger than MinBytes, the capacity goes down to twice the
+/// size (but not below MinBytes). Between the two thresholds nothing
+/// moves, so a size that oscillates within a factor of Fraction / 2 never
+/// reallocates.
+template <typename Base = DoublingGrowth, std::size_t Fraction = 4, std::size_t MinBytes = 4096>
+struct ShrinkingGrowth
+{
+    typedef char FractionAboveTwo[Fraction > 2 ? 1 : -1];
+
+    static std::size_t grow(const std::size_t capacity, const std::size_t required, const std::size_t elementSize);
+    static std::size_t shrink(const std::size_t capacity, const std::size_t size, const std::size_t elementSize);
+};
+
+#include "../templates/GrowthPolicy.cpp"
+
+#endif /// __GROWTH_POLICY_HPP__
@@ -0,0 +1,63 @@
+#ifndef __MALLOC_ALLOCATOR_HPP__
+#define __MALLOC_ALLOCATOR_HPP__
+
+#include "AllocatorTraits.hpp"
+
+#include <cstddef>
+
+/// Stateless allocator on top of malloc/free. Its AllocatorTraits report
+/// the usable size of every block (malloc_usable_size on glibc), so a
+/// Vector using it counts the size-class slack as capacity.
+template <typename T>
+class MallocAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef MallocAllocator<U> other;
+    };
+
+    MallocAllocator();
+    MallocAllocator(const MallocAllocator& rhv);
+    template <typename U> MallocAllocator(const MallocAllocator<U>& rhv);
+    ~MallocAllocator();
+
+    pointer allocate(const size_type n, const void* hint = 0);
+    void deallocate(pointer p, const size_type n);
+    size_type max_size() const;
+    void construct(pointer p, const_reference value);
+    void destroy(pointer p);
+    pointer address(reference r) const;
+    const_pointer address(const_reference r) const;
+};
+
+template <typename T, typename U>
+bool operator==(const MallocAllocator<T>& lhv, const MallocAllocator<U>& rhv);
+template <typename T, typename U>
+bool operator!=(const MallocAllocator<T>& lhv, const MallocAllocator<U>& rhv);
+
+template <typename T>
+struct AllocatorTraits<MallocAllocator<T> >
+{
+    typedef typename MallocAllocator<T>::pointer pointer;
+    typedef typename MallocAllocator<T>::const_pointer const_pointer;
+    typedef typename MallocAllocator<T>::size_type size_type;
+    static const bool ALWAYS_TRANSFERABLE = true;
+
+    static pointer allocateAtLeast(MallocAllocator<T>& allocator, const size_type n, size_type& allocated);
+    static pointer reallocate(MallocAllocator<T>& allocator, pointer p, const size_type capacity, const size_type n, size_type& allocated);
+    static bool isTransferable(const MallocAllocator<T>& allocator, const_pointer p);
+};
+
+#include "../templates/MallocAllocator.cpp"
+
+#endif /// __MALLOC_ALLOCATOR_HPP__
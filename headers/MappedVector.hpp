@@ -0,0 +1,154 @@
+#ifndef __MAPPED_VECTOR_HPP__
+#define __MAPPED_VECTOR_HPP__
+
+#include "AllocatorTraits.hpp"
+#include "Vector.hpp"
+
+#include <cstddef>
+
+/// Read-write shared mapping of a file laid out as a fixed HEADER_SIZE
+/// header followed by the raw elements. The file only ever grows; its
+/// length bounds the capacity recorded in the header.
+class MappedFile
+{
+public:
+    static const std::size_t HEADER_SIZE = 64;
+    static const unsigned long long MAGIC = 0x3156434556504d4dULL; /// "MMPVECV1"
+    static const unsigned int VERSION = 1;
+
+    MappedFile(const char* path, const std::size_t elementSize);
+    ~MappedFile();
+    std::size_t elementSize() const;
+    /// Element count and capacity recorded by the last sync().
+    std::size_t storedCount() const;
+    std::size_t storedCapacity() const;
+    unsigned long long storedChecksum() const;
+    /// Maps at least bytes of payload, growing the file when it is shorter,
+    /// and returns the payload address. Sets mapped to the usable bytes.
+    void* map(const std::size_t bytes, std::size_t& mapped);
+    /// Grows the current mapping to at least bytes of payload; the payload
+    /// may move to a new address but keeps its contents.
+    void* remap(const std::size_t bytes, std::size_t& mapped);
+    void unmap();
+    /// Writes the header and flushes the mapping to the file.
+    void sync(const std::size_t count, const std::size_t capacity, const unsigned long long checksum);
+
+    static unsigned long long checksum(const void* data, const std::size_t bytes);
+
+private:
+    MappedFile(const MappedFile& rhv);
+    MappedFile& operator=(const MappedFile& rhv);
+    void readHeader();
+    void writeHeader();
+    void ensureLength(const std::size_t bytes);
+
+private:
+    struct Header
+    {
+        unsigned long long magic;
+        unsigned int version;
+        unsigned int elementSize;
+        unsigned long long count;
+        unsigned long long capacity;
+        unsigned long long checksum;
+    };
+
+    int fd_;
+    char* base_;
+    std::size_t mappedBytes_;
+    std::size_t fileBytes_;
+    Header header_;
+};
+
+/// Allocator handing out the payload of a MappedFile. There is only one
+/// buffer per file, so growth goes through AllocatorTraits::reallocate.
+template <typename T>
+class FileMappingAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef FileMappingAllocator<U> other;
+    };
+
+    explicit FileMappingAllocator(MappedFile* file = NULL);
+    FileMappingAllocator(const FileMappingAllocator& rhv);
+    template <typename U> FileMappingAllocator(const FileMappingAllocator<U>& rhv);
+    ~FileMappingAllocator();
+
+    pointer allocate(const size_type n, const void* hint = 0);
+    void deallocate(pointer p, const size_type n);
+    size_type max_size() const;
+    void construct(pointer p, const_reference value);
+    void destroy(pointer p);
+    pointer address(reference r) const;
+    const_pointer address(const_reference r) const;
+    MappedFile* file() const;
+
+private:
+    MappedFile* file_;
+};
+
+template <typename T, typename U>
+bool operator==(const FileMappingAllocator<T>& lhv, const FileMappingAllocator<U>& rhv);
+template <typename T, typename U>
+bool operator!=(const FileMappingAllocator<T>& lhv, const FileMappingAllocator<U>& rhv);
+
+template <typename T>
+struct AllocatorTraits<FileMappingAllocator<T> >
+{
+    typedef typename FileMappingAllocator<T>::pointer pointer;
+    typedef typename FileMappingAllocator<T>::const_pointer const_pointer;
+    typedef typename FileMappingAllocator<T>::size_type size_type;
+    static const bool ALWAYS_TRANSFERABLE = false;
+
+    static pointer allocateAtLeast(FileMappingAllocator<T>& allocator, const size_type n, size_type& allocated);
+    static pointer reallocate(FileMappingAllocator<T>& allocator, pointer p, const size_type capacity, const size_type n, size_type& allocated);
+    static bool isTransferable(const FileMappingAllocator<T>& allocator, const_pointer p);
+};
+
+/// Owns the file of a MappedVector; a base so that it outlives the Vector
+/// part, which unmaps the payload in its destructor.
+class MappedFileOwner
+{
+protected:
+    MappedFileOwner(const char* path, const std::size_t elementSize);
+
+    MappedFile file_;
+};
+
+/// Vector whose elements live in a file. Opening an existing file maps it
+/// and pages elements in on demand; nothing is parsed or copied. Growing
+/// extends the file and remaps it. The header is rewritten by sync() and
+/// by the destructor. Only for trivially copyable T.
+template <typename T, typename Growth = DoublingGrowth>
+class MappedVector : private MappedFileOwner, public Vector<T, FileMappingAllocator<T>, Growth>
+{
+    typedef Vector<T, FileMappingAllocator<T>, Growth> Base;
+    typedef char TriviallyCopyableElementsOnly[(IsTriviallyCopyable<T>::value && IsTriviallyDefaultConstructible<T>::value) ? 1 : -1];
+public:
+    typedef typename Base::size_type size_type;
+
+    /// Opens or creates path. With verify, the stored checksum of the
+    /// elements is checked and std::runtime_error thrown on mismatch.
+    explicit MappedVector(const char* path, const bool verify = false);
+    ~MappedVector();
+    void sync();
+
+private:
+    MappedVector(const MappedVector& rhv);
+    MappedVector& operator=(const MappedVector& rhv);
+};
+
+#include "../templates/MappedVector.cpp"
+
+#endif /// __MAPPED_VECTOR_HPP__
@@ -0,0 +1,85 @@
+#ifndef __MMAP_ALLOCATOR_HPP__
+#define __MMAP_ALLOCATOR_HPP__
+
+#include "AllocatorTraits.hpp"
+
+#include <cstddef>
+
+/// Anonymous private page mappings. Mappings of at least HUGE_PAGE_SIZE
+/// bytes are aligned to it and advised for transparent huge pages.
+class PageMapping
+{
+public:
+    static const std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    static std::size_t pageSize();
+    static std::size_t roundUp(const std::size_t bytes);
+    static void* map(const std::size_t bytes);
+    static void unmap(void* ptr, const std::size_t bytes);
+    /// Moves the pages of ptr into a mapping of newBytes without copying
+    /// them. Returns NULL, leaving ptr intact, where that is not possible.
+    static void* remap(void* ptr, const std::size_t oldBytes, const std::size_t newBytes);
+};
+
+/// Stateless allocator serving blocks of at least Threshold bytes straight
+/// from PageMapping and smaller ones from malloc. Its AllocatorTraits grow
+/// mapped blocks with remap, so a Vector of trivially relocatable elements
+/// never copies them once it is past the threshold.
+template <typename T, std::size_t Threshold = 1024 * 1024>
+class MmapAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static const std::size_t THRESHOLD = Threshold;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef MmapAllocator<U, Threshold> other;
+    };
+
+    MmapAllocator();
+    MmapAllocator(const MmapAllocator& rhv);
+    template <typename U> MmapAllocator(const MmapAllocator<U, Threshold>& rhv);
+    ~MmapAllocator();
+
+    pointer allocate(const size_type n, const void* hint = 0);
+    void deallocate(pointer p, const size_type n);
+    size_type max_size() const;
+    void construct(pointer p, const_reference value);
+    void destroy(pointer p);
+    pointer address(reference r) const;
+    const_pointer address(const_reference r) const;
+
+    /// Whether a block of n elements is served by a page mapping.
+    static bool isMapped(const size_type n);
+};
+
+template <typename T, typename U, std::size_t Threshold>
+bool operator==(const MmapAllocator<T, Threshold>& lhv, const MmapAllocator<U, Threshold>& rhv);
+template <typename T, typename U, std::size_t Threshold>
+bool operator!=(const MmapAllocator<T, Threshold>& lhv, const MmapAllocator<U, Threshold>& rhv);
+
+template <typename T, std::size_t Threshold>
+struct AllocatorTraits<MmapAllocator<T, Threshold> >
+{
+    typedef typename MmapAllocator<T, Threshold>::pointer pointer;
+    typedef typename MmapAllocator<T, Threshold>::const_pointer const_pointer;
+    typedef typename MmapAllocator<T, Threshold>::size_type size_type;
+    static const bool ALWAYS_TRANSFERABLE = true;
+
+    static pointer allocateAtLeast(MmapAllocator<T, Threshold>& allocator, const size_type n, size_type& allocated);
+    static pointer reallocate(MmapAllocator<T, Threshold>& allocator, pointer p, const size_type capacity, const size_type n, size_type& allocated);
+    static bool isTransferable(const MmapAllocator<T, Threshold>& allocator, const_pointer p);
+};
+
+#include "../templates/MmapAllocator.cpp"
+
+#endif /// __MMAP_ALLOCATOR_HPP__
@@ -0,0 +1,119 @@
+#ifndef __PARALLEL_HPP__
+#define __PARALLEL_HPP__
+
+#include "ThreadPool.hpp"
+#include "TypeTraits.hpp"
+#include "Vector.hpp"
+
+#include <cstddef>
+
+/// Parallel algorithms over random-access ranges and Vectors. The range is
+/// cut into chunks of grain elements that run on pool (the shared
+/// ThreadPool::instance() when NULL); ranges of at most one chunk run on
+/// the calling thread. Function objects are shared by all threads, and
+/// reduce / scan operations must be associative.
+template <typename RandomIt, typename Function>
+void parallel_for_each(RandomIt first, RandomIt last, Function f,
+                       const std::size_t grain = ThreadPool::DEFAULT_GRAIN, ThreadPool* pool = NULL);
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+OutputIt parallel_transform(RandomIt first, RandomIt last, OutputIt out, UnaryOperation op,
+                            const std::size_t grain = ThreadPool::DEFAULT_GRAIN, ThreadPool* pool = NULL);
+template <typename RandomIt, typename T, typename BinaryOperation>
+T parallel_reduce(RandomIt first, RandomIt last, T init, BinaryOperation op,
+                  const std::size_t grain = ThreadPool::DEFAULT_GRAIN, ThreadPool* pool = NULL);
+/// out may equal first.
+template <typename RandomIt, typename OutputIt, typename BinaryOperation>
+OutputIt parallel_inclusive_scan(RandomIt first, RandomIt last, OutputIt out, BinaryOperation op,
+                                 const std::size_t grain = ThreadPool::DEFAULT_GRAIN, ThreadPool* pool = NULL);
+
+/// Vector forms work on the raw element pointers.
+template <typename T, typename Alloc, typename Growth, typename Function>
+void parallel_for_each(Vector<T, Alloc, Growth>& vector, Function f,
+                       const std::size_t grain = ThreadPool::DEFAULT_GRAIN, ThreadPool* pool = NULL);
+template <typename T, typename Alloc, typename Growth, typename U, typename AllocU, typename GrowthU, typename UnaryOperation>
+void parallel_transform(const Vector<T, Alloc, Growth>& in, Vector<U, AllocU, GrowthU>& out, UnaryOperation op,
+                        const std::size_t grain = ThreadPool::DEFAULT_GRAIN, ThreadPool* pool = NULL);
+template <typename T, typename Alloc, typename Growth, typename U, typename BinaryOperation>
+U parallel_reduce(const Vector<T, Alloc, Growth>& vector, U init, BinaryOperation op,
+                  const std::size_t grain = ThreadPool::DEFAULT_GRAIN, ThreadPool* pool = NULL);
+template <typename T, typename Alloc, typename Growth, typename BinaryOperation>
+void parallel_inclusive_scan(Vector<T, Alloc, Growth>& vector, BinaryOperation op,
+                             const std::size_t grain = ThreadPool::DEFAULT_GRAIN, ThreadPool* pool = NULL);
+
+/// Chunk bookkeeping shared by the parallel tasks. Iterators are only
+/// ever moved with += so that Vector's own iterators work as well.
+template <typename RandomIt>
+class ChunkedRange
+{
+public:
+    ChunkedRange(RandomIt first, const std::size_t size, const std::size_t grain);
+    std::size_t chunks() const;
+    std::size_t begin(const std::size_t chunk) const;
+    std::size_t end(const std::size_t chunk) const;
+    RandomIt at(const std::size_t index) const;
+    template <typename Iterator> static Iterator advance(Iterator it, const std::size_t n);
+
+private:
+    RandomIt first_;
+    std::size_t size_;
+    std::size_t grain_;
+};
+
+template <typename RandomIt, typename Function>
+class ForEachTask : public ThreadPool::Task
+{
+public:
+    ForEachTask(const ChunkedRange<RandomIt>& range, Function& f);
+    void run(const std::size_t chunk);
+
+private:
+    const ChunkedRange<RandomIt>& range_;
+    Function& f_;
+};
+
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+class TransformTask : public ThreadPool::Task
+{
+public:
+    TransformTask(const ChunkedRange<RandomIt>& range, OutputIt out, UnaryOperation& op);
+    void run(const std::size_t chunk);
+
+private:
+    const ChunkedRange<RandomIt>& range_;
+    OutputIt out_;
+    UnaryOperation& op_;
+};
+
+/// Folds every chunk into partials[chunk], starting from its first element.
+template <typename RandomIt, typename T, typename BinaryOperation>
+class ReduceTask : public ThreadPool::Task
+{
+public:
+    ReduceTask(const ChunkedRange<RandomIt>& range, Vector<T>& partials, BinaryOperation& op);
+    void run(const std::size_t chunk);
+
+private:
+    const ChunkedRange<RandomIt>& range_;
+    Vector<T>& partials_;
+    BinaryOperation& op_;
+};
+
+/// Second scan pass: chunk c > 0 starts from offsets[c - 1], the total of
+/// all chunks before it.
+template <typename RandomIt, typename OutputIt, typename T, typename BinaryOperation>
+class ScanTask : public ThreadPool::Task
+{
+public:
+    ScanTask(const ChunkedRange<RandomIt>& range, OutputIt out, const Vector<T>& offsets, BinaryOperation& op);
+    void run(const std::size_t chunk);
+
+private:
+    const ChunkedRange<RandomIt>& range_;
+    OutputIt out_;
+    const Vector<T>& offsets_;
+    BinaryOperation& op_;
+};
+
+#include "../templates/Parallel.cpp"
+
+#endif /// __PARALLEL_HPP__
@@ -0,0 +1,160 @@
+#ifndef __PERSISTENT_VECTOR_HPP__
+#define __PERSISTENT_VECTOR_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <iterator>
+
+/// Immutable sequence stored as a 32-way trie of full leaves plus a tail
+/// leaf for the last elements. push_back, set, take and drop return a new
+/// version that shares every node except the O(log32 n) nodes on the
+/// changed path, so old versions stay valid and cheap to keep. Nodes are
+/// reference counted atomically: versions may be read, copied and
+/// released from different threads. drop() only moves an offset, so the
+/// dropped prefix stays alive until its last version is released (the
+/// whole trie is let go once only the tail is left).
+template <typename T>
+class PersistentVector
+{
+public:
+    typedef T value_type;
+    typedef const T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static const size_type BITS = 5;
+    static const size_type WIDTH = static_cast<size_type>(1) << BITS;
+    static const size_type MASK = WIDTH - 1;
+
+    /// Random access iterator that caches the leaf it is in.
+    class const_iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        const_iterator();
+        const_iterator(const PersistentVector* vector, const size_type index);
+
+        reference operator*() const;
+        pointer operator->() const;
+        reference operator[](const difference_type n) const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        const_iterator& operator--();
+        const_iterator operator--(int);
+        const_iterator& operator+=(const difference_type n);
+        const_iterator& operator-=(const difference_type n);
+        const_iterator operator+(const difference_type n) const;
+        const_iterator operator-(const difference_type n) const;
+        difference_type operator-(const const_iterator& rhv) const;
+        bool operator==(const const_iterator& rhv) const;
+        bool operator!=(const const_iterator& rhv) const;
+        bool operator<(const const_iterator& rhv) const;
+        bool operator<=(const const_iterator& rhv) const;
+        bool operator>(const const_iterator& rhv) const;
+        bool operator>=(const const_iterator& rhv) const;
+
+    private:
+        const PersistentVector* vector_;
+        size_type index_;
+        mutable const T* leaf_;
+        mutable size_type leafStart_;
+    };
+    typedef const_iterator iterator;
+
+    PersistentVector();
+    template <typename Alloc, typename Growth> explicit PersistentVector(const Vector<T, Alloc, Growth>& elements);
+    template <typename InputIterator> PersistentVector(InputIterator f, InputIterator l);
+    PersistentVector(const PersistentVector& rhv);
+    ~PersistentVector();
+    PersistentVector& operator=(const PersistentVector& rhv);
+    void swap(PersistentVector& rhv);
+
+    size_type size() const;
+    bool empty() const;
+    const_reference operator[](const size_type index) const;
+    const_reference front() const;
+    const_reference back() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+    bool operator==(const PersistentVector& rhv) const;
+    bool operator!=(const PersistentVector& rhv) const;
+
+    PersistentVector push_back(const_reference value) const;
+    PersistentVector pop_back() const;
+    PersistentVector set(const size_type index, const_reference value) const;
+    /// The first n elements.
+    PersistentVector take(const size_type n) const;
+    /// All but the first n elements.
+    PersistentVector drop(const size_type n) const;
+    /// Elements [first, last).
+    PersistentVector slice(const size_type first, const size_type last) const;
+
+    Vector<T> toVector() const;
+    template <typename Alloc, typename Growth> void appendTo(Vector<T, Alloc, Growth>& out) const;
+
+private:
+    struct Node
+    {
+        unsigned long references;
+        size_type count;
+    };
+
+    struct Branch : Node
+    {
+        Node* children[WIDTH];
+    };
+
+    /// count elements constructed in raw storage.
+    struct Leaf : Node
+    {
+        union Storage
+        {
+            char bytes[WIDTH * sizeof(T)];
+            long double alignLongDouble;
+            long long alignLongLong;
+            void* alignPointer;
+        } storage;
+
+        T* values();
+        const T* values() const;
+    };
+
+    void append(const_reference value);
+    void pushTailIntoTree();
+    void releaseAll();
+    size_type tailOffset() const;
+    const Leaf* leafFor(const size_type physical) const;
+
+    static size_type tailOffset(const size_type size);
+    static void retain(Node* node);
+    static void release(Node* node, const size_type shift);
+    static Branch* newBranch();
+    static Branch* copyBranch(const Branch* source);
+    static Leaf* copyLeaf(const Leaf* source, const size_type count, const size_type replaced, const T* value);
+    static Node* newPath(const size_type shift, Leaf* leaf);
+    static Branch* pushTail(const size_type shift, const Branch* parent, Leaf* tail, const size_type last);
+    static Node* assign(const size_type shift, const Node* node, const size_type physical, const_reference value);
+    static Branch* truncate(const Branch* node, const size_type shift, const size_type count);
+
+private:
+    Branch* root_;
+    Leaf* tail_;
+    size_type shift_;
+    /// Physical element count, including the offset_ dropped elements.
+    size_type size_;
+    size_type offset_;
+};
+
+template <typename T>
+void swap(PersistentVector<T>& lhv, PersistentVector<T>& rhv);
+
+#include "../templates/PersistentVector.cpp"
+
+#endif /// __PERSISTENT_VECTOR_HPP__
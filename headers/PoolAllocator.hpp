@@ -0,0 +1,87 @@
+#ifndef __POOL_ALLOCATOR_HPP__
+#define __POOL_ALLOCATOR_HPP__
+
+#include <cstddef>
+
+/// Pool of equally sized chunks recycled through an intrusive free list.
+/// Chunks come from blocks of chunksPerBlock chunks that are only returned
+/// to the system when the pool is destroyed.
+class FixedPool
+{
+public:
+    static const std::size_t DEFAULT_CHUNKS_PER_BLOCK = 256;
+
+    explicit FixedPool(const std::size_t chunkSize, const std::size_t chunksPerBlock = DEFAULT_CHUNKS_PER_BLOCK);
+    ~FixedPool();
+    void* allocate();
+    void deallocate(void* chunk);
+    std::size_t chunkSize() const;
+    std::size_t freeCount() const;
+
+private:
+    FixedPool(const FixedPool& rhv);
+    FixedPool& operator=(const FixedPool& rhv);
+    void grow();
+
+private:
+    struct Node
+    {
+        Node* next;
+    };
+
+    Node* freeList_;
+    Node* blocks_;
+    std::size_t chunkSize_;
+    std::size_t chunksPerBlock_;
+};
+
+/// Serves every request that fits into one chunk of the pool and falls back
+/// to ::operator new for larger ones. Suited for many small Vectors whose
+/// capacity stays below chunkSize() / sizeof(T).
+template <typename T>
+class PoolAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef PoolAllocator<U> other;
+    };
+
+    explicit PoolAllocator(FixedPool& pool);
+    PoolAllocator(const PoolAllocator& rhv);
+    template <typename U> PoolAllocator(const PoolAllocator<U>& rhv);
+    ~PoolAllocator();
+
+    pointer allocate(const size_type n, const void* hint = 0);
+    void deallocate(pointer p, const size_type n);
+    size_type max_size() const;
+    void construct(pointer p, const_reference value);
+    void destroy(pointer p);
+    pointer address(reference r) const;
+    const_pointer address(const_reference r) const;
+    FixedPool* pool() const;
+
+private:
+    bool fitsChunk(const size_type n) const;
+
+private:
+    FixedPool* pool_;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>& lhv, const PoolAllocator<U>& rhv);
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>& lhv, const PoolAllocator<U>& rhv);
+
+#include "../templates/PoolAllocator.cpp"
+
+#endif /// __POOL_ALLOCATOR_HPP__
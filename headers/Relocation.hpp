@@ -0,0 +1,160 @@
+#ifndef __RELOCATION_HPP__
+#define __RELOCATION_HPP__
+
+#include <cstddef>
+
+#if __cplusplus >= 201103L
+#include <type_traits>
+#endif
+
+/// Element traits Vector uses to choose, at compile time, how elements are
+/// moved between and inside buffers. IsTriviallyRelocatable may be
+/// specialized for user types that survive a raw byte move (e.g. a class
+/// owning a heap pointer) but are not trivially copyable.
+template <typename T>
+struct IsTriviallyCopyable
+{
+    static const bool value = __is_trivially_copyable(T);
+};
+
+template <typename T>
+struct IsTriviallyDestructible
+{
+    static const bool value = __has_trivial_destructor(T);
+};
+
+template <typename T>
+struct IsTriviallyDefaultConstructible
+{
+    static const bool value = __has_trivial_constructor(T);
+};
+
+template <typename T>
+struct IsTriviallyRelocatable
+{
+    static const bool value = IsTriviallyCopyable<T>::value;
+};
+
+template <typename T>
+struct IsNothrowMovable
+{
+#if __cplusplus >= 201103L
+    static const bool value = std::is_nothrow_move_constructible<T>::value;
+#else
+    static const bool value = false;
+#endif
+};
+
+enum RelocationKind
+{
+    RELOCATE_BITWISE,
+    RELOCATE_MOVE,
+    RELOCATE_COPY
+};
+
+template <typename T>
+struct RelocationTraits
+{
+    static const RelocationKind kind = IsTriviallyRelocatable<T>::value ? RELOCATE_BITWISE
+                                     : IsNothrowMovable<T>::value       ? RELOCATE_MOVE
+                                     :                                    RELOCATE_COPY;
+};
+
+/// relocate         - moves n elements into uninitialized, non-overlapping dst
+/// relocateAround   - same, leaving gap uninitialized slots in dst before
+///                    the element that was src[index]
+/// relocateBackward - same as relocate for overlapping ranges with dst > src
+/// relocateForward  - same as relocate for overlapping ranges with dst < src
+/// In all cases the source elements are dead afterwards. If a copy throws,
+/// every source element is still alive (the overlapping moves only promise
+/// valid, not original, values) and no destination slot outside the source
+/// range is left constructed.
+template <typename T, RelocationKind Kind = RelocationTraits<T>::kind>
+struct Relocator;
+
+template <typename T>
+struct Relocator<T, RELOCATE_BITWISE>
+{
+    static void relocate(T* dst, T* src, const std::size_t n);
+    static void relocateAround(T* dst, T* src, const std::size_t n, const std::size_t index, const std::size_t gap);
+    static void relocateBackward(T* dst, T* src, const std::size_t n);
+    static void relocateForward(T* dst, T* src, const std::size_t n);
+};
+
+#if __cplusplus >= 201103L
+template <typename T>
+struct Relocator<T, RELOCATE_MOVE>
+{
+    static void relocate(T* dst, T* src, const std::size_t n);
+    static void relocateAround(T* dst, T* src, const std::size_t n, const std::size_t index, const std::size_t gap);
+    static void relocateBackward(T* dst, T* src, const std::size_t n);
+    static void relocateForward(T* dst, T* src, const std::size_t n);
+};
+#endif
+
+template <typename T>
+struct Relocator<T, RELOCATE_COPY>
+{
+    static void relocate(T* dst, T* src, const std::size_t n);
+    static void relocateAround(T* dst, T* src, const std::size_t n, const std::size_t index, const std::size_t gap);
+    static void relocateBackward(T* dst, T* src, const std::size_t n);
+    static void relocateForward(T* dst, T* src, const std::size_t n);
+};
+
+template <typename T, bool Trivial = IsTriviallyDestructible<T>::value>
+struct Destroyer
+{
+    static void destroy(T* first, T* last);
+};
+
+template <typename T>
+struct Destroyer<T, true>
+{
+    static void destroy(T* first, T* last);
+};
+
+/// Copy-constructs n elements from src into uninitialized dst. If a copy
+/// throws, the elements built so far are destroyed again.
+template <typename T, bool Trivial = IsTriviallyCopyable<T>::value>
+struct Copier
+{
+    static void construct(T* dst, const T* src, const std::size_t n);
+};
+
+template <typename T>
+struct Copier<T, true>
+{
+    static void construct(T* dst, const T* src, const std::size_t n);
+};
+
+/// Copy-constructs n copies of value into uninitialized dst. Trivially
+/// copyable types are written with memset when every byte of value is the
+/// same, and otherwise by replicating a small pattern block with memcpy.
+template <typename T, bool Trivial = IsTriviallyCopyable<T>::value>
+struct Filler
+{
+    static void construct(T* dst, const std::size_t n, const T& value);
+};
+
+template <typename T>
+struct Filler<T, true>
+{
+    static void construct(T* dst, const std::size_t n, const T& value);
+};
+
+/// Default-initializes n elements, which leaves trivial types unwritten.
+template <typename T, bool Trivial = IsTriviallyDefaultConstructible<T>::value>
+struct DefaultInitializer
+{
+    static void construct(T* dst, const std::size_t n);
+};
+
+template <typename T>
+struct DefaultInitializer<T, true>
+{
+    static void construct(T* dst, const std::size_t n);
+};
+
+#include "../templates/Relocation.cpp"
+
+#endif /// __RELOCATION_HPP__
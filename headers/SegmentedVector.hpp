@@ -0,0 +1,124 @@
+#ifndef __SEGMENTED_VECTOR_HPP__
+#define __SEGMENTED_VECTOR_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+/// Sequence stored in fixed blocks of BlockSize elements listed in a block
+/// directory. Growing allocates one more block and never moves elements,
+/// so references, pointers and iterators stay valid until the element is
+/// popped or the container cleared. Only the directory, one pointer per
+/// block, is reallocated as it grows. BlockSize must be a power of two.
+template <typename T, std::size_t BlockSize = 1024, typename Alloc = std::allocator<T> >
+class SegmentedVector
+{
+    typedef char BlockSizeIsPowerOfTwo[(BlockSize != 0 && 0 == (BlockSize & (BlockSize - 1))) ? 1 : -1];
+public:
+    typedef T value_type;
+    typedef Alloc allocator_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static const size_type BLOCK_SIZE = BlockSize;
+
+    /// Iterators keep the container and an index, so they survive growth.
+    template <typename Value, typename Container>
+    class basic_iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef Value value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Value* pointer;
+        typedef Value& reference;
+
+        basic_iterator();
+        basic_iterator(Container* container, const size_type index);
+        template <typename OtherValue, typename OtherContainer>
+        basic_iterator(const basic_iterator<OtherValue, OtherContainer>& rhv);
+
+        reference operator*() const;
+        pointer operator->() const;
+        reference operator[](const difference_type n) const;
+        basic_iterator& operator++();
+        basic_iterator operator++(int);
+        basic_iterator& operator--();
+        basic_iterator operator--(int);
+        basic_iterator& operator+=(const difference_type n);
+        basic_iterator& operator-=(const difference_type n);
+        basic_iterator operator+(const difference_type n) const;
+        basic_iterator operator-(const difference_type n) const;
+        difference_type operator-(const basic_iterator& rhv) const;
+        bool operator==(const basic_iterator& rhv) const;
+        bool operator!=(const basic_iterator& rhv) const;
+        bool operator<(const basic_iterator& rhv) const;
+        bool operator<=(const basic_iterator& rhv) const;
+        bool operator>(const basic_iterator& rhv) const;
+        bool operator>=(const basic_iterator& rhv) const;
+        Container* container() const;
+        size_type index() const;
+
+    private:
+        Container* container_;
+        size_type index_;
+    };
+
+    typedef basic_iterator<T, SegmentedVector> iterator;
+    typedef basic_iterator<const T, const SegmentedVector> const_iterator;
+
+    explicit SegmentedVector(const Alloc& allocator = Alloc());
+    SegmentedVector(const size_type n, const_reference value, const Alloc& allocator = Alloc());
+    SegmentedVector(const SegmentedVector& rhv);
+    ~SegmentedVector();
+    SegmentedVector& operator=(const SegmentedVector& rhv);
+    void swap(SegmentedVector& rhv);
+
+    size_type size() const;
+    bool empty() const;
+    size_type capacity() const;
+    size_type blockCount() const;
+    void reserve(const size_type n);
+    void resize(const size_type n, const_reference value = T());
+    void push_back(const_reference element);
+#if __cplusplus >= 201103L
+    void push_back(T&& element);
+    template <typename... Args> void emplace_back(Args&&... args);
+#endif
+    void pop_back();
+    void clear();
+    /// Frees the blocks that hold no elements.
+    void shrink_to_fit();
+
+    reference operator[](const size_type index);
+    const_reference operator[](const size_type index) const;
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+    iterator begin();
+    const_iterator begin() const;
+    iterator end();
+    const_iterator end() const;
+
+    bool operator==(const SegmentedVector& rhv) const;
+    bool operator!=(const SegmentedVector& rhv) const;
+
+private:
+    T* slotFor(const size_type index);
+    void addBlock();
+
+private:
+    Vector<T*> blocks_;
+    size_type size_;
+    Alloc allocator_;
+};
+
+#include "../templates/SegmentedVector.cpp"
+
+#endif /// __SEGMENTED_VECTOR_HPP__
@@ -0,0 +1,47 @@
+#ifndef __SIMD_COMPARE_HPP__
+#define __SIMD_COMPARE_HPP__
+
+#include "TypeTraits.hpp"
+
+#include <cstddef>
+
+/// Mismatch kernels behind Vector's comparison operators. Each returns the
+/// index of the first position where the ranges differ, or n when they do
+/// not. On x86 the AVX2 or SSE2 variant is picked on first use from the
+/// CPU's feature flags; other targets use the scalar loop. Floating-point
+/// kernels compare with ==, so NaN never matches and -0.0 matches 0.0.
+std::size_t mismatchBytes(const void* a, const void* b, const std::size_t n);
+std::size_t mismatchFloats(const float* a, const float* b, const std::size_t n);
+std::size_t mismatchDoubles(const double* a, const double* b, const std::size_t n);
+
+enum CompareKind
+{
+    COMPARE_GENERIC,
+    COMPARE_BYTES,
+    COMPARE_FLOAT,
+    COMPARE_DOUBLE
+};
+
+template <typename T>
+struct CompareTraits
+{
+    static const CompareKind kind = IsIntegral<T>::value ? COMPARE_BYTES : COMPARE_GENERIC;
+};
+
+template <> struct CompareTraits<float> { static const CompareKind kind = COMPARE_FLOAT; };
+template <> struct CompareTraits<double> { static const CompareKind kind = COMPARE_DOUBLE; };
+
+/// equal    - n elements of a and b compare equal
+/// mismatch - first index i < n with !(a[i] == b[i]), or n
+/// less     - single-pass lexicographical a[0, na) < b[0, nb)
+template <typename T, CompareKind Kind = CompareTraits<T>::kind>
+struct RangeCompare
+{
+    static bool equal(const T* a, const T* b, const std::size_t n);
+    static std::size_t mismatch(const T* a, const T* b, const std::size_t n);
+    static bool less(const T* a, const std::size_t na, const T* b, const std::size_t nb);
+};
+
+#include "../templates/SimdCompare.cpp"
+
+#endif /// __SIMD_COMPARE_HPP__
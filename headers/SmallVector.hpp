@@ -0,0 +1,101 @@
+#ifndef __SMALL_VECTOR_HPP__
+#define __SMALL_VECTOR_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+
+/// Allocator owning an in-object buffer for N elements. The first request
+/// of at most N elements is served from that buffer (and reported to
+/// Vector as exactly N elements of capacity); everything else goes to
+/// ::operator new. Copies start with their own, empty buffer.
+template <typename T, std::size_t N>
+class SmallBufferAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef SmallBufferAllocator<U, N> other;
+    };
+
+    SmallBufferAllocator();
+    SmallBufferAllocator(const SmallBufferAllocator& rhv);
+    template <typename U> SmallBufferAllocator(const SmallBufferAllocator<U, N>& rhv);
+    ~SmallBufferAllocator();
+    SmallBufferAllocator& operator=(const SmallBufferAllocator& rhv);
+
+    pointer allocate(const size_type n, const void* hint = 0);
+    void deallocate(pointer p, const size_type n);
+    size_type max_size() const;
+    void construct(pointer p, const_reference value);
+    void destroy(pointer p);
+    pointer address(reference r) const;
+    const_pointer address(const_reference r) const;
+    bool isInline(const_pointer p) const;
+
+private:
+    pointer inlineBuffer();
+
+private:
+    char buffer_[(0 == N ? 1 : N) * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+    bool used_;
+};
+
+template <typename T, std::size_t N, typename U, std::size_t M>
+bool operator==(const SmallBufferAllocator<T, N>& lhv, const SmallBufferAllocator<U, M>& rhv);
+template <typename T, std::size_t N, typename U, std::size_t M>
+bool operator!=(const SmallBufferAllocator<T, N>& lhv, const SmallBufferAllocator<U, M>& rhv);
+
+template <typename T, std::size_t N>
+struct AllocatorTraits<SmallBufferAllocator<T, N> >
+{
+    typedef typename SmallBufferAllocator<T, N>::pointer pointer;
+    typedef typename SmallBufferAllocator<T, N>::const_pointer const_pointer;
+    typedef typename SmallBufferAllocator<T, N>::size_type size_type;
+    static const bool ALWAYS_TRANSFERABLE = false;
+
+    static pointer allocateAtLeast(SmallBufferAllocator<T, N>& allocator, const size_type n, size_type& allocated);
+    static pointer reallocate(SmallBufferAllocator<T, N>& allocator, pointer p, const size_type capacity, const size_type n, size_type& allocated);
+    static bool isTransferable(const SmallBufferAllocator<T, N>& allocator, const_pointer p);
+};
+
+/// Vector that keeps up to N elements inside the object and spills to the
+/// heap only when they no longer fit. Moving or swapping a SmallVector
+/// moves the elements while they are inline and steals the buffer once
+/// they are on the heap, so it can only throw when T has no non-throwing
+/// move and the elements are inline.
+template <typename T, std::size_t N, typename Growth = DoublingGrowth>
+class SmallVector : public Vector<T, SmallBufferAllocator<T, N>, Growth>
+{
+    typedef Vector<T, SmallBufferAllocator<T, N>, Growth> Base;
+public:
+    typedef typename Base::size_type size_type;
+    typedef typename Base::const_reference const_reference;
+    static const size_type INLINE_CAPACITY = N;
+
+    SmallVector();
+    SmallVector(const size_type size);
+    SmallVector(const size_type n, const_reference t);
+    SmallVector(const int n, const_reference t);
+    template <typename InputIterator> SmallVector(InputIterator f, InputIterator l);
+    SmallVector(const SmallVector& rhv);
+    SmallVector& operator=(const SmallVector& rhv);
+#if __cplusplus >= 201103L
+    SmallVector(SmallVector&& rhv) noexcept(RelocationTraits<T>::kind != RELOCATE_COPY);
+    SmallVector& operator=(SmallVector&& rhv) noexcept(RelocationTraits<T>::kind != RELOCATE_COPY);
+#endif
+    bool isInline() const;
+};
+
+#include "../templates/SmallVector.cpp"
+
+#endif /// __SMALL_VECTOR_HPP__
@@ -0,0 +1,128 @@
+#ifndef __SOA_VECTOR_HPP__
+#define __SOA_VECTOR_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+
+/// Placeholder for the unused trailing fields of a SoaVector.
+struct SoaNone
+{
+    bool operator==(const SoaNone&) const { return true; }
+};
+
+/// Column operations; the SoaNone specialization turns them into no-ops so
+/// unused fields cost nothing.
+template <typename F>
+struct SoaColumnOps
+{
+    static void reserve(Vector<F>& column, const std::size_t n);
+    static void resize(Vector<F>& column, const std::size_t n, const F& value);
+    static void push_back(Vector<F>& column, const F& value);
+    static void pop_back(Vector<F>& column);
+    static void erase(Vector<F>& column, const std::size_t first, const std::size_t last);
+    static void clear(Vector<F>& column);
+};
+
+template <>
+struct SoaColumnOps<SoaNone>
+{
+    static void reserve(Vector<SoaNone>&, const std::size_t) {}
+    static void resize(Vector<SoaNone>&, const std::size_t, const SoaNone&) {}
+    static void push_back(Vector<SoaNone>&, const SoaNone&) {}
+    static void pop_back(Vector<SoaNone>&) {}
+    static void erase(Vector<SoaNone>&, const std::size_t, const std::size_t) {}
+    static void clear(Vector<SoaNone>&) {}
+};
+
+/// Type and storage of field I of a SoaVector<F1, F2, F3, F4>.
+template <std::size_t I, typename F1, typename F2, typename F3, typename F4>
+struct SoaField;
+
+template <typename F1, typename F2, typename F3, typename F4>
+struct SoaField<0, F1, F2, F3, F4>
+{
+    typedef F1 type;
+    typedef Vector<F1> column_type;
+    static column_type& get(Vector<F1>& c0, Vector<F2>&, Vector<F3>&, Vector<F4>&) { return c0; }
+    static const column_type& get(const Vector<F1>& c0, const Vector<F2>&, const Vector<F3>&, const Vector<F4>&) { return c0; }
+};
+
+template <typename F1, typename F2, typename F3, typename F4>
+struct SoaField<1, F1, F2, F3, F4>
+{
+    typedef F2 type;
+    typedef Vector<F2> column_type;
+    static column_type& get(Vector<F1>&, Vector<F2>& c1, Vector<F3>&, Vector<F4>&) { return c1; }
+    static const column_type& get(const Vector<F1>&, const Vector<F2>& c1, const Vector<F3>&, const Vector<F4>&) { return c1; }
+};
+
+template <typename F1, typename F2, typename F3, typename F4>
+struct SoaField<2, F1, F2, F3, F4>
+{
+    typedef F3 type;
+    typedef Vector<F3> column_type;
+    static column_type& get(Vector<F1>&, Vector<F2>&, Vector<F3>& c2, Vector<F4>&) { return c2; }
+    static const column_type& get(const Vector<F1>&, const Vector<F2>&, const Vector<F3>& c2, const Vector<F4>&) { return c2; }
+};
+
+template <typename F1, typename F2, typename F3, typename F4>
+struct SoaField<3, F1, F2, F3, F4>
+{
+    typedef F4 type;
+    typedef Vector<F4> column_type;
+    static column_type& get(Vector<F1>&, Vector<F2>&, Vector<F3>&, Vector<F4>& c3) { return c3; }
+    static const column_type& get(const Vector<F1>&, const Vector<F2>&, const Vector<F3>&, const Vector<F4>& c3) { return c3; }
+};
+
+/// Records of up to four fields stored as one Vector per field, so that a
+/// scan over one field streams only that field's memory. Rows are
+/// addressed by index; column<I>() exposes field I as a plain Vector and
+/// begin<I>() / end<I>() iterate it mutably. Every operation keeps all
+/// columns the same length, and a throwing element copy leaves the
+/// SoaVector unchanged.
+template <typename F1, typename F2, typename F3 = SoaNone, typename F4 = SoaNone>
+class SoaVector
+{
+public:
+    typedef std::size_t size_type;
+
+    template <std::size_t I>
+    struct field
+    {
+        typedef typename SoaField<I, F1, F2, F3, F4>::type type;
+        typedef typename SoaField<I, F1, F2, F3, F4>::column_type column_type;
+        typedef typename column_type::iterator iterator;
+        typedef typename column_type::const_iterator const_iterator;
+    };
+
+    SoaVector();
+    size_type size() const;
+    bool empty() const;
+    void reserve(const size_type n);
+    void resize(const size_type n, const F1& f1 = F1(), const F2& f2 = F2(), const F3& f3 = F3(), const F4& f4 = F4());
+    void push_back(const F1& f1, const F2& f2, const F3& f3 = F3(), const F4& f4 = F4());
+    void pop_back();
+    void erase(const size_type index);
+    void erase(const size_type first, const size_type last);
+    void clear();
+    void swap(SoaVector& rhv);
+    bool operator==(const SoaVector& rhv) const;
+    bool operator!=(const SoaVector& rhv) const;
+
+    template <std::size_t I> const typename field<I>::column_type& column() const;
+    template <std::size_t I> typename field<I>::iterator begin();
+    template <std::size_t I> typename field<I>::iterator end();
+    template <std::size_t I> const typename field<I>::type& get(const size_type index) const;
+    template <std::size_t I> void set(const size_type index, const typename field<I>::type& value);
+
+private:
+    Vector<F1> column0_;
+    Vector<F2> column1_;
+    Vector<F3> column2_;
+    Vector<F4> column3_;
+};
+
+#include "../templates/SoaVector.cpp"
+
+#endif /// __SOA_VECTOR_HPP__
@@ -0,0 +1,145 @@
+#ifndef __STATIC_VECTOR_HPP__
+#define __STATIC_VECTOR_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+
+/// What StaticVector does with elements that do not fit. Every growing
+/// operation reports false when it could not store everything.
+/// OverflowAssert - asserts (and behaves like OverflowFail with NDEBUG)
+/// OverflowFail   - leaves the container untouched
+/// OverflowDrop   - stores what fits and drops the rest
+struct OverflowAssert
+{
+    static const bool TRUNCATE = false;
+    static void overflow();
+};
+
+struct OverflowFail
+{
+    static const bool TRUNCATE = false;
+    static void overflow();
+};
+
+struct OverflowDrop
+{
+    static const bool TRUNCATE = true;
+    static void overflow();
+};
+
+/// Allocator owning an in-object buffer for exactly N elements. It never
+/// falls back to the heap; asking it for more throws std::bad_alloc.
+template <typename T, std::size_t N>
+class FixedBufferAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef FixedBufferAllocator<U, N> other;
+    };
+
+    FixedBufferAllocator();
+    FixedBufferAllocator(const FixedBufferAllocator& rhv);
+    template <typename U> FixedBufferAllocator(const FixedBufferAllocator<U, N>& rhv);
+    ~FixedBufferAllocator();
+    FixedBufferAllocator& operator=(const FixedBufferAllocator& rhv);
+
+    pointer allocate(const size_type n, const void* hint = 0);
+    void deallocate(pointer p, const size_type n);
+    size_type max_size() const;
+    void construct(pointer p, const_reference value);
+    void destroy(pointer p);
+    pointer address(reference r) const;
+    const_pointer address(const_reference r) const;
+
+private:
+    char buffer_[(0 == N ? 1 : N) * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+};
+
+template <typename T, std::size_t N, typename U, std::size_t M>
+bool operator==(const FixedBufferAllocator<T, N>& lhv, const FixedBufferAllocator<U, M>& rhv);
+template <typename T, std::size_t N, typename U, std::size_t M>
+bool operator!=(const FixedBufferAllocator<T, N>& lhv, const FixedBufferAllocator<U, M>& rhv);
+
+template <typename T, std::size_t N>
+struct AllocatorTraits<FixedBufferAllocator<T, N> >
+{
+    typedef typename FixedBufferAllocator<T, N>::pointer pointer;
+    typedef typename FixedBufferAllocator<T, N>::const_pointer const_pointer;
+    typedef typename FixedBufferAllocator<T, N>::size_type size_type;
+    static const bool ALWAYS_TRANSFERABLE = false;
+
+    static pointer allocateAtLeast(FixedBufferAllocator<T, N>& allocator, const size_type n, size_type& allocated);
+    static pointer reallocate(FixedBufferAllocator<T, N>& allocator, pointer p, const size_type capacity, const size_type n, size_type& allocated);
+    static bool isTransferable(const FixedBufferAllocator<T, N>& allocator, const_pointer p);
+};
+
+/// Vector with a compile-time capacity of N elements stored in the object
+/// itself; it never calls operator new. Shifting, comparison and iteration
+/// are Vector's own, only the growing operations are replaced by versions
+/// that apply the Overflow policy. Growing it past N through a Vector
+/// reference bypasses the policy and throws std::bad_alloc. Moving and
+/// swapping relocate the elements one by one and throw whatever copying T
+/// throws when T has no non-throwing move.
+template <typename T, std::size_t N, typename Overflow = OverflowAssert>
+class StaticVector : public Vector<T, FixedBufferAllocator<T, N> >
+{
+    typedef Vector<T, FixedBufferAllocator<T, N> > Base;
+public:
+    typedef typename Base::size_type size_type;
+    typedef typename Base::value_type value_type;
+    typedef typename Base::const_reference const_reference;
+    typedef typename Base::iterator iterator;
+    typedef Overflow overflow_policy;
+
+    StaticVector();
+    StaticVector(const size_type size);
+    StaticVector(const size_type n, const_reference t);
+    StaticVector(const int n, const_reference t);
+    template <typename InputIterator> StaticVector(InputIterator f, InputIterator l);
+    StaticVector(const StaticVector& rhv);
+    StaticVector& operator=(const StaticVector& rhv);
+#if __cplusplus >= 201103L
+    StaticVector(StaticVector&& rhv) noexcept(RelocationTraits<T>::kind != RELOCATE_COPY);
+    StaticVector& operator=(StaticVector&& rhv) noexcept(RelocationTraits<T>::kind != RELOCATE_COPY);
+#endif
+
+    size_type max_size() const;
+    bool full() const;
+    bool reserve(const size_type n);
+    bool resize(const size_type n, const_reference init = value_type());
+    bool resize_uninitialized(const size_type n);
+    bool push_back(const_reference element);
+#if __cplusplus >= 201103L
+    bool push_back(value_type&& element);
+    template <typename... Args> bool emplace_back(Args&&... args);
+    iterator insert(iterator pos, value_type&& x);
+    template <typename... Args> iterator emplace(iterator pos, Args&&... args);
+#endif
+    iterator insert(iterator pos, const_reference x);
+    bool insert(iterator pos, const size_type n, const_reference x);
+    bool insert(iterator pos, const int n, const_reference x);
+    template <typename InputIterator>
+    bool insert(iterator pos, InputIterator f, InputIterator l);
+
+private:
+    size_type room() const;
+    template <typename Integer>
+    bool rangeInsert(iterator pos, Integer n, Integer value, TrueType);
+    template <typename InputIterator>
+    bool rangeInsert(iterator pos, InputIterator f, InputIterator l, FalseType);
+};
+
+#include "../templates/StaticVector.cpp"
+
+#endif /// __STATIC_VECTOR_HPP__
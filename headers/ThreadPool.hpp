@@ -0,0 +1,85 @@
+#ifndef __THREAD_POOL_HPP__
+#define __THREAD_POOL_HPP__
+
+#include <cstddef>
+#include <pthread.h>
+
+#if __cplusplus >= 201103L
+#include <exception>
+#endif
+
+/// Fixed set of worker threads that run the chunks [0, chunks) of one task
+/// at a time. The calling thread takes part as well. Each participant
+/// starts on a contiguous share of the chunks, pops its own chunks in
+/// order, and steals the upper half of another share once its own is
+/// exhausted. A run() issued from inside a task runs sequentially.
+class ThreadPool
+{
+public:
+    static const std::size_t DEFAULT_GRAIN = 16 * 1024;
+
+    class Task
+    {
+    public:
+        virtual ~Task();
+        virtual void run(const std::size_t chunk) = 0;
+    };
+
+    /// threads counts the calling thread; 0 means one per online CPU.
+    explicit ThreadPool(const std::size_t threads = 0);
+    ~ThreadPool();
+    std::size_t size() const;
+    /// Returns when every chunk has run. Once a chunk throws no further
+    /// chunks are handed out, and when the running ones are done the first
+    /// exception is rethrown; before C++11 as a std::runtime_error with the
+    /// same what().
+    void run(Task& task, const std::size_t chunks);
+
+    static ThreadPool& instance();
+    static std::size_t hardwareThreads();
+
+private:
+    ThreadPool(const ThreadPool& rhv);
+    ThreadPool& operator=(const ThreadPool& rhv);
+    static void* workerMain(void* argument);
+    void workerLoop(const std::size_t slot);
+    void work(Task& task, const std::size_t slot);
+    void fail();
+    bool pop(const std::size_t slot, std::size_t& chunk);
+    bool steal(const std::size_t slot, std::size_t& chunk);
+
+private:
+    /// [begin, end) packed as begin << 32 | end, alone on a cache line.
+    struct Slot
+    {
+        unsigned long long range;
+        char padding[64 - sizeof(unsigned long long)];
+    };
+
+    struct Worker
+    {
+        ThreadPool* pool;
+        std::size_t slot;
+    };
+
+    std::size_t size_;
+    Slot* slots_;
+    Worker* workers_;
+    pthread_t* threads_;
+    pthread_mutex_t runMutex_;
+    pthread_mutex_t mutex_;
+    pthread_cond_t wake_;
+    pthread_cond_t done_;
+    Task* task_;
+    unsigned long generation_;
+    std::size_t active_;
+    bool failed_;
+#if __cplusplus >= 201103L
+    std::exception_ptr error_;
+#else
+    char message_[256];
+#endif
+    bool stop_;
+};
+
+#endif /// __THREAD_POOL_HPP__
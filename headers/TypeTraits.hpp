@@ -0,0 +1,82 @@
+#ifndef __TYPE_TRAITS_HPP__
+#define __TYPE_TRAITS_HPP__
+
+#include <iterator>
+
+/// Minimal C++03 stand-ins for the <type_traits> pieces the containers
+/// dispatch on. Tag arguments derive from TrueType / FalseType, so an
+/// overload taking the base class accepts every trait result.
+template <bool Value>
+struct BoolConstant
+{
+    static const bool value = Value;
+};
+
+typedef BoolConstant<true> TrueType;
+typedef BoolConstant<false> FalseType;
+
+template <typename T> struct IsIntegral : FalseType {};
+template <typename T> struct IsIntegral<const T> : IsIntegral<T> {};
+template <> struct IsIntegral<bool> : TrueType {};
+template <> struct IsIntegral<char> : TrueType {};
+template <> struct IsIntegral<signed char> : TrueType {};
+template <> struct IsIntegral<unsigned char> : TrueType {};
+template <> struct IsIntegral<wchar_t> : TrueType {};
+template <> struct IsIntegral<short> : TrueType {};
+template <> struct IsIntegral<unsigned short> : TrueType {};
+template <> struct IsIntegral<int> : TrueType {};
+template <> struct IsIntegral<unsigned int> : TrueType {};
+template <> struct IsIntegral<long> : TrueType {};
+template <> struct IsIntegral<unsigned long> : TrueType {};
+template <> struct IsIntegral<long long> : TrueType {};
+template <> struct IsIntegral<unsigned long long> : TrueType {};
+
+template <typename T> struct IsFloatingPoint : FalseType {};
+template <typename T> struct IsFloatingPoint<const T> : IsFloatingPoint<T> {};
+template <> struct IsFloatingPoint<float> : TrueType {};
+template <> struct IsFloatingPoint<double> : TrueType {};
+template <> struct IsFloatingPoint<long double> : TrueType {};
+
+template <typename T>
+struct IsArithmetic : BoolConstant<IsIntegral<T>::value || IsFloatingPoint<T>::value> {};
+
+/// Category of an iterator without requiring the full std::iterator_traits
+/// typedef set, which Vector's own iterators do not provide.
+template <typename Iterator>
+struct IteratorCategory
+{
+    typedef typename Iterator::iterator_category type;
+};
+
+template <typename T>
+struct IteratorCategory<T*>
+{
+    typedef std::random_access_iterator_tag type;
+};
+
+template <typename T>
+struct IteratorCategory<const T*>
+{
+    typedef std::random_access_iterator_tag type;
+};
+
+/// Element type of an iterator, on the same terms as IteratorCategory.
+template <typename Iterator>
+struct IteratorValue
+{
+    typedef typename Iterator::value_type type;
+};
+
+template <typename T>
+struct IteratorValue<T*>
+{
+    typedef T type;
+};
+
+template <typename T>
+struct IteratorValue<const T*>
+{
+    typedef T type;
+};
+
+#endif /// __TYPE_TRAITS_HPP__
@@ -1,16 +1,33 @@
 #ifndef __VECTOR_HPP__
 #define __VECTOR_HPP__
 
+#include "AllocatorTraits.hpp"
+#include "GrowthPolicy.hpp"
+#include "Relocation.hpp"
+#include "SimdCompare.hpp"
+#include "TypeTraits.hpp"
+#include "VectorStats.hpp"
+
 #include <iostream>
+#include <memory>
+
+#if __cplusplus >= 201103L
+#define VECTOR_NOEXCEPT_IF(condition) noexcept(condition)
+#else
+#define VECTOR_NOEXCEPT_IF(condition)
+#endif
 
-template <typename T> class Vector;
-template <typename T> std::ostream& operator<<(std::ostream& out, const Vector<T>& vector);
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth> class Vector;
+template <typename T, typename Alloc, typename Growth>
+std::ostream& operator<<(std::ostream& out, const Vector<T, Alloc, Growth>& vector);
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 class Vector
 {
 public:
     typedef T value_type;
+    typedef Alloc allocator_type;
+    typedef Growth growth_policy;
     typedef value_type& reference;
     typedef const value_type& const_reference;
     typedef value_type* pointer;
@@ -19,8 +36,12 @@ public:
 
     class const_iterator
     {
-        friend class Vector<T>;
+        friend class Vector<T, Alloc, Growth>;
     public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+
         const_iterator();
         const_iterator(const const_iterator& rhv);
         ~const_iterator();
@@ -57,7 +78,7 @@ public:
 
     class iterator : public const_iterator
     {
-        friend class Vector<T>;
+        friend class Vector<T, Alloc, Growth>;
     public:
         iterator();
         iterator(const iterator& rhv);
@@ -72,6 +93,7 @@ public:
         iterator& operator-(const int rhv);
         const_reference operator->();
         reference operator[](const size_type size);
+        iterator& operator=(const iterator& rhv);
         iterator& operator=(const const_iterator& rhv);
         bool operator==(const iterator& rhv);
         bool operator!=(const iterator& rhv);
@@ -81,8 +103,12 @@ public:
 
     class const_reverse_iterator
     {
-        friend class Vector<T>;
+        friend class Vector<T, Alloc, Growth>;
     public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+
         const_reverse_iterator();
         const_reverse_iterator(const const_reverse_iterator& rhv);
         ~const_reverse_iterator();
@@ -113,7 +139,7 @@ public:
 
     class reverse_iterator : public const_reverse_iterator
     {
-        friend class Vector<T>;
+        friend class Vector<T, Alloc, Growth>;
     public:
         reverse_iterator();
         reverse_iterator(const reverse_iterator& rhv);
@@ -121,6 +147,7 @@ public:
         reference operator*();
         const_reference operator->();
         reference operator[](const size_type size);
+        reverse_iterator& operator=(const reverse_iterator& rhv);
         reverse_iterator& operator=(const const_reverse_iterator& rhv);
         bool operator==(const reverse_iterator& rhv);
         bool operator!=(const reverse_iterator& rhv);
@@ -130,26 +157,44 @@ public:
     };
 
     Vector();
-    Vector(const size_type size);
-    Vector(const size_type n, const_reference t);
-    Vector(const int n, const_reference t);
-    template <typename InputIterator> Vector(InputIterator f, InputIterator l);
+    explicit Vector(const Alloc& allocator);
+    Vector(const size_type size, const Alloc& allocator = Alloc());
+    Vector(const size_type n, const_reference t, const Alloc& allocator = Alloc());
+    Vector(const int n, const_reference t, const Alloc& allocator = Alloc());
+    template <typename InputIterator> Vector(InputIterator f, InputIterator l, const Alloc& allocator = Alloc());
+    Vector(const Vector& rhv);
     ~Vector();
+    Vector& operator=(const Vector& rhv);
+#if __cplusplus >= 201103L
+    Vector(Vector&& rhv) noexcept(AllocatorTraits<Alloc>::ALWAYS_TRANSFERABLE);
+    Vector& operator=(Vector&& rhv) noexcept(AllocatorTraits<Alloc>::ALWAYS_TRANSFERABLE);
+#endif
+    /// Cannot throw when the buffers may change owner. Buffers inside the
+    /// allocator (SmallVector, StaticVector) are relocated element by
+    /// element instead, which may throw.
+    void swap(Vector& rhv) VECTOR_NOEXCEPT_IF(AllocatorTraits<Alloc>::ALWAYS_TRANSFERABLE);
+    allocator_type get_allocator() const;
     size_type size() const;
     size_type max_size() const;
     void resize(const size_type n, const T& init = T());
+    void resize_uninitialized(const size_type n);
     void push_back(const const_reference element);
+#if __cplusplus >= 201103L
+    void push_back(value_type&& element);
+    template <typename... Args> void emplace_back(Args&&... args);
+#endif
     void pop_back();
     void clear();
     size_type capacity() const;
     void reserve(const size_type n);
+    void shrink_to_fit();
     const_reference operator[](const size_type index) const ;
-    bool operator==(const Vector<T>& rhv) const;
-    bool operator!=(const Vector<T>& rhv) const;
-    bool operator<(const Vector<T>& rhv) const;
-    bool operator<=(const Vector<T>& rhv) const;
-    bool operator>(const Vector<T>& rhv) const;
-    bool operator>=(const Vector<T>& rhv) const;
+    bool operator==(const Vector& rhv) const;
+    bool operator!=(const Vector& rhv) const;
+    bool operator<(const Vector& rhv) const;
+    bool operator<=(const Vector& rhv) const;
+    bool operator>(const Vector& rhv) const;
+    bool operator>=(const Vector& rhv) const;
     const_iterator begin() const;
     iterator begin();
     const_iterator end() const;
@@ -159,6 +204,10 @@ public:
     const_reverse_iterator rend() const;
     reverse_iterator rend();
     iterator insert(iterator pos, const_reference x);
+#if __cplusplus >= 201103L
+    iterator insert(iterator pos, value_type&& x);
+    template <typename... Args> iterator emplace(iterator pos, Args&&... args);
+#endif
     void insert(iterator pos, const size_type n, const_reference x);
     void insert(iterator pos, const int n, const_reference x);
     template <typename InputIterator>
@@ -166,12 +215,45 @@ public:
     iterator erase(iterator pos);
     iterator erase(iterator f, iterator l);
 
+protected:
+    const Alloc& allocatorRef() const;
+
+private:
+    size_type nextCapacity(const size_type required) const;
+    void shrinkTo(const size_type n);
+    void shrinkIfSparse();
+    bool contains(const T* element) const;
+    T* openGap(const size_type index, const size_type n);
+    void closeGap(const size_type index, const size_type n);
+    template <typename Integer>
+    void rangeInsert(const size_type index, Integer n, Integer value, TrueType);
+    template <typename InputIterator>
+    void rangeInsert(const size_type index, InputIterator f, InputIterator l, FalseType);
+    template <typename InputIterator>
+    void rangeInsert(const size_type index, InputIterator f, InputIterator l, std::input_iterator_tag);
+    template <typename ForwardIterator>
+    void rangeInsert(const size_type index, ForwardIterator f, ForwardIterator l, std::forward_iterator_tag);
+    void contiguousInsert(const size_type index, const T* f, const T* l);
+    bool isTransferable() const;
+    void relocateFrom(Vector& rhv);
+    void takeFrom(Vector& rhv);
+    template <typename Iterator> static const T* contiguousAddress(const Iterator& it);
+    static const T* contiguousAddress(const const_iterator& it);
+    static const T* contiguousAddress(const iterator& it);
+    static const T* contiguousAddress(const T* it);
+    static const T* contiguousAddress(T* it);
+
 private:
     T* begin_;
     T* end_;
     T* bufferEnd_;
+    Alloc allocator_;
 };
 
+template <typename T, typename Alloc, typename Growth>
+void swap(Vector<T, Alloc, Growth>& lhv, Vector<T, Alloc, Growth>& rhv) VECTOR_NOEXCEPT_IF(AllocatorTraits<Alloc>::ALWAYS_TRANSFERABLE);
+
 #include "../templates/Vector.cpp"
+#include "BitVector.hpp"
 
 #endif /// __VECTOR_HPP__
@@ -0,0 +1,139 @@
+#ifndef __VECTOR_IO_HPP__
+#define __VECTOR_IO_HPP__
+
+#include "Relocation.hpp"
+#include "TypeTraits.hpp"
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <iostream>
+
+/// Fixed SIZE-byte header of the binary Vector format. It is followed
+/// either by count raw elements or, with the CHUNKED flag, by chunks of a
+/// 64-bit element count and that many elements, ended by an empty chunk.
+/// Fields are stored in the writer's byte order, which endianTag reveals.
+struct BinaryHeader
+{
+    static const std::size_t SIZE = 32;
+    static const unsigned int VERSION = 1;
+    static const unsigned int ENDIAN_TAG = 0x01020304;
+    static const unsigned int CHUNKED = 1;
+
+    BinaryHeader();
+    BinaryHeader(const std::size_t elementSize, const unsigned long long count, const unsigned int flags = 0);
+    /// Fills the header from SIZE bytes, throwing std::runtime_error on a
+    /// bad magic, an unknown version or an unknown byte order.
+    void decode(const char* bytes);
+    void encode(char* bytes) const;
+    bool swapped() const;
+
+    unsigned int version;
+    unsigned int elementSize;
+    unsigned int endianTag;
+    unsigned int flags;
+    unsigned long long count;
+};
+
+/// Blocking whole-buffer I/O, throwing std::runtime_error on failure or a
+/// premature end of input.
+class BinaryIO
+{
+public:
+    static void write(std::ostream& out, const void* data, const std::size_t bytes);
+    static void read(std::istream& in, void* data, const std::size_t bytes);
+    /// Writes header and payload with as few writev calls as possible.
+    static void write(const int fd, const void* header, const std::size_t headerBytes, const void* data, const std::size_t bytes);
+    static void read(const int fd, void* data, const std::size_t bytes);
+    static void swapBytes(void* data, const std::size_t elementSize, const std::size_t n);
+};
+
+/// Fixes the byte order of freshly read elements. Only arithmetic types
+/// can be converted; for the others a foreign byte order is an error.
+template <typename T, bool Arithmetic = IsArithmetic<T>::value>
+struct ByteOrder
+{
+    static void fromForeign(T* data, const std::size_t n);
+};
+
+template <typename T>
+struct ByteOrder<T, true>
+{
+    static void fromForeign(T* data, const std::size_t n);
+};
+
+/// Binary format entry points, defined for trivially copyable T only.
+template <typename T, bool Trivial = IsTriviallyCopyable<T>::value>
+struct BinaryCodec;
+
+template <typename T>
+struct BinaryCodec<T, true>
+{
+    static void encodeHeader(char* bytes, const std::size_t count, const unsigned int flags = 0);
+    /// Sources are a std::istream or a file descriptor.
+    template <typename Source>
+    static void readHeader(Source& source, BinaryHeader& header);
+    template <typename Source>
+    static unsigned long long readChunkSize(Source& source, const BinaryHeader& header);
+    template <typename Source>
+    static void readElements(Source& source, T* data, const std::size_t n, const BinaryHeader& header);
+    template <typename Source, typename Alloc, typename Growth>
+    static void readVector(Source& source, Vector<T, Alloc, Growth>& vector);
+};
+
+template <typename T, typename Alloc, typename Growth>
+void writeBinary(std::ostream& out, const Vector<T, Alloc, Growth>& vector);
+template <typename T, typename Alloc, typename Growth>
+void readBinary(std::istream& in, Vector<T, Alloc, Growth>& vector);
+template <typename T, typename Alloc, typename Growth>
+void writeBinary(const int fd, const Vector<T, Alloc, Growth>& vector);
+template <typename T, typename Alloc, typename Growth>
+void readBinary(const int fd, Vector<T, Alloc, Growth>& vector);
+
+/// Writes a CHUNKED stream one chunk at a time, so the whole sequence
+/// never has to be in memory. finish() writes the terminating chunk.
+template <typename T>
+class BinaryChunkWriter
+{
+public:
+    explicit BinaryChunkWriter(std::ostream& out);
+    void write(const T* data, const std::size_t n);
+    template <typename Alloc, typename Growth>
+    void write(const Vector<T, Alloc, Growth>& chunk);
+    void finish();
+
+private:
+    BinaryChunkWriter(const BinaryChunkWriter& rhv);
+    BinaryChunkWriter& operator=(const BinaryChunkWriter& rhv);
+
+private:
+    std::ostream& out_;
+    bool finished_;
+};
+
+/// Reads a binary stream of either layout back in chunks of at most
+/// maxChunk elements.
+template <typename T>
+class BinaryChunkReader
+{
+public:
+    explicit BinaryChunkReader(std::istream& in, const std::size_t maxChunk = 1 << 20);
+    /// Replaces chunk with the next elements; false once the input is done.
+    template <typename Alloc, typename Growth>
+    bool read(Vector<T, Alloc, Growth>& chunk);
+
+private:
+    BinaryChunkReader(const BinaryChunkReader& rhv);
+    BinaryChunkReader& operator=(const BinaryChunkReader& rhv);
+    bool nextChunk();
+
+private:
+    std::istream& in_;
+    BinaryHeader header_;
+    std::size_t maxChunk_;
+    unsigned long long remaining_;
+    bool done_;
+};
+
+#include "../templates/VectorIO.cpp"
+
+#endif /// __VECTOR_IO_HPP__
@@ -0,0 +1,101 @@
+#ifndef __VECTOR_STATS_HPP__
+#define __VECTOR_STATS_HPP__
+
+#include <cstddef>
+#include <iosfwd>
+
+/// Instrumentation is compiled in only when VECTOR_STATS is defined and
+/// NDEBUG is not; otherwise every VECTOR_STATS_HOOK is an empty statement.
+#if defined(VECTOR_STATS) && !defined(NDEBUG)
+#define VECTOR_STATS_ENABLED 1
+#define VECTOR_STATS_HOOK(V, call) VectorStatsHooks<V>::call
+#else
+#define VECTOR_STATS_HOOK(V, call) static_cast<void>(0)
+#endif
+
+/// Counters of one Vector instantiation. The histograms are filled when a
+/// Vector owning a buffer is destroyed: sizeHistogram[i] counts final sizes
+/// in [2^(i-1), 2^i) (bucket 0 is the empty Vector) and fillHistogram[i]
+/// the buffers whose size * 10 / capacity was i.
+struct VectorStatsCounters
+{
+    static const std::size_t SIZE_BUCKETS = sizeof(std::size_t) * 8 + 1;
+    static const std::size_t FILL_BUCKETS = 11;
+
+    const char* name;
+    std::size_t elementSize;
+    unsigned long allocations;
+    unsigned long reallocations;
+    unsigned long growths;
+    unsigned long implicitGrowths;
+    unsigned long shrinks;
+    unsigned long bytesRelocated;
+    unsigned long bytesCopied;
+    unsigned long elementsShifted;
+    unsigned long resizes;
+    unsigned long destroyed;
+    unsigned long wastedBytes;
+    unsigned long sizeHistogram[SIZE_BUCKETS];
+    unsigned long fillHistogram[FILL_BUCKETS];
+    VectorStatsCounters* next;
+};
+
+/// One capacity increase; inPlace is set when the allocator extended the
+/// buffer without a new allocation.
+struct VectorGrowthEvent
+{
+    const VectorStatsCounters* stats;
+    const void* vector;
+    std::size_t size;
+    std::size_t oldCapacity;
+    std::size_t newCapacity;
+    bool inPlace;
+};
+
+typedef void (*VectorGrowthCallback)(const VectorGrowthEvent& event, void* context);
+
+/// Registry of the counters of every instantiation that has been used.
+/// Counters are updated atomically; the callback should be installed
+/// before Vectors start growing on other threads.
+class VectorStats
+{
+public:
+    template <typename V> static const VectorStatsCounters& of();
+    static const VectorStatsCounters* first();
+    static void reset();
+    static void report(std::ostream& out);
+    static void setGrowthCallback(VectorGrowthCallback callback, void* context = NULL);
+
+    static bool enroll(VectorStatsCounters* counters, const char* name, const std::size_t elementSize);
+    static void notify(const VectorGrowthEvent& event);
+    static void add(unsigned long& counter, const unsigned long n);
+    static std::size_t sizeBucket(const std::size_t size);
+
+private:
+    static VectorStatsCounters* head_;
+    static VectorGrowthCallback callback_;
+    static void* context_;
+};
+
+/// Entry points Vector calls through VECTOR_STATS_HOOK.
+template <typename V>
+class VectorStatsHooks
+{
+public:
+    typedef typename V::size_type size_type;
+    typedef typename V::value_type value_type;
+
+    static VectorStatsCounters& counters();
+    static void grew(const V* vector, const size_type size, const size_type oldCapacity,
+                     const size_type newCapacity, const bool inPlace);
+    static void implicitGrowth();
+    static void shrank();
+    static void copied(const size_type n);
+    static void shifted(const size_type n);
+    static void resized();
+    static void destroyed(const size_type size, const size_type capacity);
+};
+
+#include "../templates/VectorStats.cpp"
+
+#endif /// __VECTOR_STATS_HPP__
@@ -0,0 +1,91 @@
+#ifndef __VECTOR_TEXT_HPP__
+#define __VECTOR_TEXT_HPP__
+
+#include "TypeTraits.hpp"
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <iostream>
+
+/// Formats numbers straight into a block buffer that goes to the stream
+/// only when full or on flush(). Integers use a two-digits-per-step table;
+/// floating point is written by FloatText as the shortest text that reads
+/// back exactly, whatever the C locale.
+class TextWriter
+{
+public:
+    static const std::size_t BUFFER_SIZE = 64 * 1024;
+
+    explicit TextWriter(std::ostream& out);
+    ~TextWriter();
+    void write(const char c);
+    void write(const char* text, const std::size_t n);
+    void writeInteger(const long long value);
+    void writeInteger(const unsigned long long value);
+    void writeFloat(const double value);
+    void writeFloat(const float value);
+    void flush();
+
+private:
+    TextWriter(const TextWriter& rhv);
+    TextWriter& operator=(const TextWriter& rhv);
+    char* reserve(const std::size_t n);
+
+private:
+    static const std::size_t MAX_NUMBER_SIZE = 48;
+
+    std::ostream& out_;
+    char* buffer_;
+    char* current_;
+};
+
+/// Number parsers over [first, last). Each returns the end of the number,
+/// or NULL when the text at first is not a number or is out of range.
+class TextReader
+{
+public:
+    static const std::size_t BUFFER_SIZE = 64 * 1024;
+
+    static const char* parseInteger(const char* first, const char* last, long long& value);
+    static const char* parseInteger(const char* first, const char* last, unsigned long long& value);
+    static const char* parseFloat(const char* first, const char* last, double& value);
+    static const char* parseFloat(const char* first, const char* last, float& value);
+    /// Spaces, tabs, line breaks, commas and semicolons separate values.
+    static bool isSeparator(const char c);
+    static const char* skipSeparators(const char* first, const char* last);
+};
+
+/// Per-type glue between Vector elements and TextWriter / TextReader,
+/// defined for arithmetic T only. Integral types, char included, are
+/// written as numbers.
+template <typename T, bool Integral = IsIntegral<T>::value, bool Floating = IsFloatingPoint<T>::value>
+struct TextCodec;
+
+template <typename T>
+struct TextCodec<T, true, false>
+{
+    static void write(TextWriter& writer, const T value);
+    static const char* parse(const char* first, const char* last, T& value);
+};
+
+template <typename T>
+struct TextCodec<T, false, true>
+{
+    static void write(TextWriter& writer, const T value);
+    static const char* parse(const char* first, const char* last, T& value);
+};
+
+/// Writes the elements separated by separator and ended by a newline.
+template <typename T, typename Alloc, typename Growth>
+void writeText(std::ostream& out, const Vector<T, Alloc, Growth>& vector, const char separator = ' ');
+/// Appends the values found in [first, last) and returns how many there
+/// were. Throws std::runtime_error at the first malformed value.
+template <typename T, typename Alloc, typename Growth>
+std::size_t parseText(const char* first, const char* last, Vector<T, Alloc, Growth>& vector);
+/// parseText() over a whole stream, read in BUFFER_SIZE blocks.
+template <typename T, typename Alloc, typename Growth>
+std::size_t readText(std::istream& in, Vector<T, Alloc, Growth>& vector);
+
+#include "../templates/VectorText.cpp"
+
+#endif /// __VECTOR_TEXT_HPP__
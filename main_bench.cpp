@@ -0,0 +1,368 @@
+#include "headers/Vector.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+/// Benchmarks Vector against std::vector and prints one JSON record per
+/// (operation, element type, size, container). Options:
+///     --max-size N    largest size, sizes go 1, 10, ..., N (default 1e6)
+///     --max-bytes N   skip sizes whose payload exceeds N bytes (default 1 GiB)
+///     --min-time MS   measured time per benchmark (default 20 ms)
+///     --output FILE   write the JSON there instead of stdout
+
+namespace {
+
+struct Blob64
+{
+    char bytes[64];
+
+    bool operator==(const Blob64& rhv) const { return 0 == ::memcmp(bytes, rhv.bytes, sizeof(bytes)); }
+    bool operator<(const Blob64& rhv) const { return ::memcmp(bytes, rhv.bytes, sizeof(bytes)) < 0; }
+};
+
+struct Options
+{
+    std::size_t maxSize;
+    std::size_t maxBytes;
+    double minTime;
+    const char* output;
+};
+
+/// Results are folded into this so the optimizer cannot drop the work.
+volatile std::size_t sink = 0;
+
+double
+now()
+{
+    timespec time;
+    ::clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+template <typename T> T makeValue(const std::size_t i);
+
+template <>
+int
+makeValue<int>(const std::size_t i)
+{
+    return static_cast<int>(i * 2654435761u);
+}
+
+template <>
+double
+makeValue<double>(const std::size_t i)
+{
+    return static_cast<double>(i) * 0.5;
+}
+
+template <>
+std::string
+makeValue<std::string>(const std::size_t i)
+{
+    char text[48];
+    ::snprintf(text, sizeof(text), "benchmark-string-value-%012lu", static_cast<unsigned long>(i));
+    return text;
+}
+
+template <>
+Blob64
+makeValue<Blob64>(const std::size_t i)
+{
+    Blob64 blob;
+    ::memset(blob.bytes, static_cast<int>(i & 0x7f), sizeof(blob.bytes));
+    return blob;
+}
+
+std::size_t touch(const int value) { return static_cast<std::size_t>(value); }
+std::size_t touch(const double value) { return static_cast<std::size_t>(value); }
+std::size_t touch(const std::string& value) { return value.size(); }
+std::size_t touch(const Blob64& value) { return static_cast<std::size_t>(value.bytes[0]); }
+
+template <typename T> const char* typeName();
+template <> const char* typeName<int>() { return "int"; }
+template <> const char* typeName<double>() { return "double"; }
+template <> const char* typeName<std::string>() { return "string"; }
+template <> const char* typeName<Blob64>() { return "blob64"; }
+
+template <typename C> const char* containerName();
+
+/// Every benchmark does its setup untimed, then times its operations on
+/// n elements. It returns the elapsed nanoseconds and sets operations to
+/// the number of element operations (or single inserts / erases) timed.
+template <typename C>
+struct Benchmarks
+{
+    typedef typename C::value_type T;
+
+    static void fill(C& c, const std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            c.push_back(makeValue<T>(i));
+        }
+    }
+
+    static double pushBack(const std::size_t n, std::size_t& operations)
+    {
+        const double start = now();
+        C c;
+        fill(c, n);
+        operations = n;
+        return now() - start;
+    }
+
+    static double reserveThenPushBack(const std::size_t n, std::size_t& operations)
+    {
+        const double start = now();
+        C c;
+        c.reserve(n);
+        fill(c, n);
+        operations = n;
+        return now() - start;
+    }
+
+    static double resize(const std::size_t n, std::size_t& operations)
+    {
+        const double start = now();
+        C c;
+        c.resize(n);
+        c.resize(n / 2);
+        c.resize(n);
+        operations = 2 * n;
+        return now() - start;
+    }
+
+    static double rangeConstruct(const std::size_t n, std::size_t& operations)
+    {
+        static std::vector<T> source;
+        if (source.size() != n) {
+            source.clear();
+            for (std::size_t i = 0; i < n; ++i) {
+                source.push_back(makeValue<T>(i));
+            }
+        }
+        const double start = now();
+        C c(source.begin(), source.end());
+        sink += c.size();
+        operations = n;
+        return now() - start;
+    }
+
+    /// Inserts and erases at position where of a container holding n
+    /// elements; at most OPERATIONS of each per repetition.
+    static const std::size_t OPERATIONS = 256;
+
+    static double insertErase(const std::size_t n, std::size_t& done, const int where)
+    {
+        C& c = prepared(n);
+        const T value = makeValue<T>(n);
+        const std::size_t operations = (n < OPERATIONS) ? n : OPERATIONS;
+        const double start = now();
+        for (std::size_t i = 0; i < operations; ++i) {
+            const std::size_t position = (0 == where) ? 0 : (1 == where) ? c.size() / 2 : c.size();
+            c.insert(c.begin() + position, value);
+        }
+        for (std::size_t i = 0; i < operations; ++i) {
+            const std::size_t position = (0 == where) ? 0 : (1 == where) ? c.size() / 2 : c.size() - 1;
+            c.erase(c.begin() + position);
+        }
+        done = 2 * operations;
+        return now() - start;
+    }
+
+    static double insertEraseFront(const std::size_t n, std::size_t& operations) { return insertErase(n, operations, 0); }
+    static double insertEraseMiddle(const std::size_t n, std::size_t& operations) { return insertErase(n, operations, 1); }
+    static double insertEraseBack(const std::size_t n, std::size_t& operations) { return insertErase(n, operations, 2); }
+
+    /// Shared n-element container for the benchmarks that leave it as is.
+    static C& prepared(const std::size_t n)
+    {
+        static C c;
+        if (c.size() != n) {
+            c.clear();
+            fill(c, n);
+        }
+        return c;
+    }
+
+    static double iterate(const std::size_t n, std::size_t& operations)
+    {
+        C& c = prepared(n);
+        const double start = now();
+        std::size_t sum = 0;
+        for (typename C::iterator it = c.begin(); it != c.end(); ++it) {
+            sum += touch(*it);
+        }
+        sink += sum;
+        operations = n;
+        return now() - start;
+    }
+
+    static double reverseIterate(const std::size_t n, std::size_t& operations)
+    {
+        C& c = prepared(n);
+        const double start = now();
+        std::size_t sum = 0;
+        for (typename C::reverse_iterator it = c.rbegin(); it != c.rend(); ++it) {
+            sum += touch(*it);
+        }
+        sink += sum;
+        operations = n;
+        return now() - start;
+    }
+
+    static double compare(const std::size_t n, std::size_t& operations)
+    {
+        static C c;
+        static C copy;
+        if (c.size() != n) {
+            c.clear();
+            fill(c, n);
+            copy = c;
+        }
+        const double start = now();
+        sink += (c == copy) ? 1 : 0;
+        sink += (c < copy) ? 1 : 0;
+        operations = 2 * n;
+        return now() - start;
+    }
+};
+
+template <> const char* containerName<Vector<int> >() { return "Vector"; }
+template <> const char* containerName<Vector<double> >() { return "Vector"; }
+template <> const char* containerName<Vector<std::string> >() { return "Vector"; }
+template <> const char* containerName<Vector<Blob64> >() { return "Vector"; }
+template <> const char* containerName<std::vector<int> >() { return "std::vector"; }
+template <> const char* containerName<std::vector<double> >() { return "std::vector"; }
+template <> const char* containerName<std::vector<std::string> >() { return "std::vector"; }
+template <> const char* containerName<std::vector<Blob64> >() { return "std::vector"; }
+
+class Report
+{
+public:
+    explicit Report(std::FILE* out)
+        : out_(out)
+        , first_(true)
+    {
+        std::fprintf(out_, "{\n  \"benchmarks\": [");
+    }
+
+    ~Report()
+    {
+        std::fprintf(out_, "\n  ]\n}\n");
+    }
+
+    void add(const char* name, const char* type, const char* container, const std::size_t size,
+             const std::size_t operations, const double nanoseconds)
+    {
+        std::fprintf(out_, "%s\n    {\"name\": \"%s\", \"type\": \"%s\", \"container\": \"%s\", "
+                     "\"size\": %lu, \"operations\": %lu, \"ns_per_op\": %.3f}",
+                     first_ ? "" : ",", name, type, container, static_cast<unsigned long>(size),
+                     static_cast<unsigned long>(operations), nanoseconds / operations);
+        first_ = false;
+        std::fflush(out_);
+    }
+
+private:
+    std::FILE* out_;
+    bool first_;
+};
+
+typedef double (*Body)(const std::size_t n, std::size_t& operations);
+
+/// One untimed warm-up run, then runs until minTime of measured time.
+template <typename C>
+void
+measure(Report& report, const Options& options, const char* name, Body body, const std::size_t n)
+{
+    std::size_t operations = 0;
+    body(n, operations);
+    double elapsed = 0;
+    std::size_t total = 0;
+    while (elapsed < options.minTime * 1e6 || 0 == total) {
+        elapsed += body(n, operations);
+        total += operations;
+    }
+    report.add(name, typeName<typename C::value_type>(), containerName<C>(), n, total, elapsed);
+}
+
+template <typename C>
+void
+runContainer(Report& report, const Options& options, const std::size_t n)
+{
+    typedef Benchmarks<C> B;
+    measure<C>(report, options, "push_back", &B::pushBack, n);
+    measure<C>(report, options, "reserve_push_back", &B::reserveThenPushBack, n);
+    measure<C>(report, options, "resize", &B::resize, n);
+    measure<C>(report, options, "range_construct", &B::rangeConstruct, n);
+    measure<C>(report, options, "insert_erase_front", &B::insertEraseFront, n);
+    measure<C>(report, options, "insert_erase_middle", &B::insertEraseMiddle, n);
+    measure<C>(report, options, "insert_erase_back", &B::insertEraseBack, n);
+    measure<C>(report, options, "iterate", &B::iterate, n);
+    measure<C>(report, options, "reverse_iterate", &B::reverseIterate, n);
+    measure<C>(report, options, "compare", &B::compare, n);
+}
+
+template <typename T>
+void
+runType(Report& report, const Options& options)
+{
+    for (std::size_t n = 1; n <= options.maxSize; n *= 10) {
+        if (n * sizeof(T) > options.maxBytes) {
+            break;
+        }
+        runContainer<std::vector<T> >(report, options, n);
+        runContainer<Vector<T> >(report, options, n);
+    }
+}
+
+std::size_t
+parseSize(const char* text)
+{
+    return static_cast<std::size_t>(std::strtod(text, NULL));
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    Options options;
+    options.maxSize = 1000000;
+    options.maxBytes = 1024 * 1024 * 1024;
+    options.minTime = 20;
+    options.output = NULL;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (0 == std::strcmp(argv[i], "--max-size")) {
+            options.maxSize = parseSize(argv[i + 1]);
+        } else if (0 == std::strcmp(argv[i], "--max-bytes")) {
+            options.maxBytes = parseSize(argv[i + 1]);
+        } else if (0 == std::strcmp(argv[i], "--min-time")) {
+            options.minTime = std::strtod(argv[i + 1], NULL);
+        } else if (0 == std::strcmp(argv[i], "--output")) {
+            options.output = argv[i + 1];
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    std::FILE* out = (NULL == options.output) ? stdout : std::fopen(options.output, "w");
+    if (NULL == out) {
+        std::perror(options.output);
+        return 1;
+    }
+    {
+        Report report(out);
+        runType<int>(report, options);
+        runType<double>(report, options);
+        runType<std::string>(report, options);
+        runType<Blob64>(report, options);
+    }
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
@@ -1,6 +1,43 @@
 #include "headers/Vector.hpp"
+#include "headers/AlignedAllocator.hpp"
+#include "headers/ArenaAllocator.hpp"
+#include "headers/BitVector.hpp"
+#include "headers/ConcurrentVector.hpp"
+#include "headers/CowVector.hpp"
+#include "headers/FlatMap.hpp"
+#include "headers/FloatText.hpp"
+#include "headers/MallocAllocator.hpp"
+#include "headers/MappedVector.hpp"
+#include "headers/MmapAllocator.hpp"
+#include "headers/Parallel.hpp"
+#include "headers/PersistentVector.hpp"
+#include "headers/PoolAllocator.hpp"
+#include "headers/SegmentedVector.hpp"
+#include "headers/SmallVector.hpp"
+#include "headers/SoaVector.hpp"
+#include "headers/StaticVector.hpp"
+#include "headers/VectorIO.hpp"
+#include "headers/VectorStats.hpp"
+#include "headers/VectorText.hpp"
 
+#include <algorithm>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
 
 TEST(VectorInt, Size)
 {
@@ -115,7 +152,8 @@ TEST(VectorInt, EqualityAndUnequality)
     Vector<int> v2(3, 3); /// 333
     Vector<int> v3(4, 1); /// 1111
     EXPECT_TRUE(v1 < v2);
-    EXPECT_TRUE(v1 <= v3);
+    EXPECT_TRUE(v3 <= v1); /// lexicographic: 1 < 2
+    EXPECT_TRUE(v3 < v1);
     EXPECT_TRUE(v2 > v1);
     EXPECT_TRUE(v2 >= v1);
     EXPECT_TRUE(v2 >= v2);
@@ -370,6 +408,1967 @@ TEST(Vector, EraseByRange1)
     EXPECT_EQ(v[3], 9);
 }
 
+TEST(VectorString, PushBackAndReserve)
+{
+    Vector<std::string> v;
+    for (int i = 0; i < 20; ++i) {
+        v.push_back(std::string(i + 1, 'a' + i));
+    }
+    v.reserve(100);
+    EXPECT_EQ(v.size(), 20);
+    EXPECT_EQ(v.capacity(), 100);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v[19], std::string(20, 't'));
+}
+
+TEST(VectorString, PushBackOwnElement)
+{
+    Vector<std::string> v;
+    v.push_back("a long string that does not fit into the small buffer");
+    v.push_back(v[0]);
+    v.push_back(v[1]);
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(v[2], v[0]);
+}
+
+TEST(VectorString, InsertAndErase)
+{
+    Vector<std::string> v;
+    v.push_back("zero");
+    v.push_back("one");
+    v.push_back("two");
+
+    v.insert(v.begin() + 1, std::string("inserted"));
+    v.insert(v.end(), 2, std::string("tail"));
+    EXPECT_EQ(v.size(), 6);
+    EXPECT_EQ(v[0], "zero");
+    EXPECT_EQ(v[1], "inserted");
+    EXPECT_EQ(v[2], "one");
+    EXPECT_EQ(v[3], "two");
+    EXPECT_EQ(v[5], "tail");
+
+    Vector<std::string>::iterator it = v.erase(v.begin(), v.begin() + 2);
+    EXPECT_EQ(*it, "one");
+    EXPECT_EQ(v.size(), 4);
+    v.erase(v.begin());
+    EXPECT_EQ(v[0], "two");
+    v.resize(1);
+    EXPECT_EQ(v.size(), 1);
+    v.pop_back();
+    EXPECT_EQ(v.size(), 0);
+}
+
+/// Copies and assignments throw once copiesLeft runs out.
+struct FlakyString
+{
+    explicit FlakyString(const char* text) : text(text) {}
+    FlakyString(const FlakyString& rhv) : text(rhv.text) { tick(); }
+    FlakyString& operator=(const FlakyString& rhv) { tick(); text = rhv.text; return *this; }
+    static void tick() { if (0 == copiesLeft--) { throw std::runtime_error("copy"); } }
+
+    std::string text;
+    static int copiesLeft;
+};
+int FlakyString::copiesLeft = -1;
+
+TEST(VectorString, ThrowingCopiesLeaveNoDeadSlots)
+{
+    const char* names[] = { "alpha", "bravo", "charlie", "delta", "echo", "foxtrot" };
+    for (int budget = 0; budget < 12; ++budget) {
+        Vector<FlakyString> v;
+        v.reserve(16);
+        for (int i = 0; i < 6; ++i) {
+            v.push_back(FlakyString(names[i]));
+        }
+        FlakyString::copiesLeft = budget;
+        try {
+            v.insert(v.begin(), FlakyString("inserted"));
+        } catch (const std::runtime_error&) {
+            EXPECT_EQ(v.size(), 6);
+        }
+        FlakyString::copiesLeft = budget;
+        try {
+            v.erase(v.begin() + 1);
+        } catch (const std::runtime_error&) {
+            EXPECT_LE(v.size(), 6);
+        }
+        FlakyString::copiesLeft = -1;
+        for (size_t i = 0; i < v.size(); ++i) {
+            EXPECT_FALSE(v[i].text.empty());
+        }
+
+        /// Growing relocates around the gap: a failure keeps the old buffer.
+        Vector<FlakyString> full;
+        for (int i = 0; i < 6; ++i) {
+            full.push_back(FlakyString(names[i]));
+        }
+        full.shrink_to_fit();
+        FlakyString::copiesLeft = budget;
+        try {
+            full.insert(full.begin() + 2, FlakyString("inserted"));
+            EXPECT_EQ(full[2].text, "inserted");
+            EXPECT_EQ(full[6].text, "foxtrot");
+        } catch (const std::runtime_error&) {
+            ASSERT_EQ(full.size(), 6);
+            for (int i = 0; i < 6; ++i) {
+                EXPECT_EQ(full[i].text, names[i]);
+            }
+        }
+        FlakyString::copiesLeft = -1;
+    }
+}
+
+TEST(Allocator, Arena)
+{
+    Arena arena(1024);
+    {
+        ArenaAllocator<int> allocator(arena);
+        Vector<int, ArenaAllocator<int> > v(allocator);
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        EXPECT_EQ(v.size(), 1000);
+        EXPECT_EQ(v[999], 999);
+
+        Vector<std::string, ArenaAllocator<std::string> > s(3, std::string("arena"), ArenaAllocator<std::string>(allocator));
+        EXPECT_EQ(s[2], "arena");
+    }
+    EXPECT_GT(arena.bytesAllocated(), 0);
+    arena.release();
+    EXPECT_EQ(arena.bytesAllocated(), 0);
+    EXPECT_EQ(arena.blockCount(), 1);
+}
+
+TEST(Allocator, ArenaReusesTopBlock)
+{
+    Arena arena(4096);
+    ArenaAllocator<int> allocator(arena);
+    int* first = allocator.allocate(4);
+    allocator.deallocate(first, 4);
+    int* second = allocator.allocate(8);
+    EXPECT_EQ(first, second);
+}
+
+TEST(Allocator, Pool)
+{
+    FixedPool pool(8 * sizeof(int), 4);
+    {
+        Vector<int, PoolAllocator<int> > v((PoolAllocator<int>(pool)));
+        v.push_back(1);
+        v.push_back(2);
+        EXPECT_EQ(pool.freeCount(), 3);
+        for (int i = 0; i < 20; ++i) {
+            v.push_back(i);
+        }
+        EXPECT_EQ(v.size(), 22);
+        EXPECT_EQ(v[21], 19);
+        EXPECT_EQ(pool.freeCount(), 4);
+    }
+    EXPECT_EQ(pool.freeCount(), 4);
+}
+
+TEST(Growth, Policies)
+{
+    EXPECT_EQ(DoublingGrowth::grow(0, 1, 4), 1);
+    EXPECT_EQ(DoublingGrowth::grow(5, 6, 4), 10);
+    EXPECT_EQ(OneAndHalfGrowth::grow(1, 2, 4), 2);
+    EXPECT_EQ(OneAndHalfGrowth::grow(4, 5, 4), 6);
+    EXPECT_EQ(OneAndHalfGrowth::grow(4, 20, 4), 20);
+    EXPECT_EQ(PageGrowth<4096>::grow(2000, 2001, 4), 3072);
+    EXPECT_EQ(PageGrowth<4096>::grow(4, 5, 4), 6);
+    EXPECT_EQ(SizeClassGrowth::sizeClass(17), 32);
+    EXPECT_EQ(SizeClassGrowth::sizeClass(65), 80);
+    EXPECT_EQ(SizeClassGrowth::sizeClass(129), 160);
+    EXPECT_EQ(SizeClassGrowth::grow(20, 21, 4), 32);
+}
+
+TEST(Growth, VectorWithPolicy)
+{
+    Vector<int, std::allocator<int>, OneAndHalfGrowth> v;
+    v.push_back(1);
+    v.push_back(2);
+    v.push_back(3);
+    EXPECT_EQ(v.capacity(), 3);
+    v.push_back(4);
+    EXPECT_EQ(v.capacity(), 4);
+    v.push_back(5);
+    EXPECT_EQ(v.capacity(), 6);
+}
+
+TEST(Growth, AllocatorSlackIsCapacity)
+{
+    Vector<char, MallocAllocator<char> > v;
+    v.push_back('a');
+    EXPECT_GE(v.capacity(), 1);
+    const Vector<char, MallocAllocator<char> >::size_type capacity = v.capacity();
+    for (Vector<char, MallocAllocator<char> >::size_type i = 1; i < capacity; ++i) {
+        v.push_back('b');
+    }
+    EXPECT_EQ(v.capacity(), capacity);
+}
+
+TEST(Vector, CopyAndAssign)
+{
+    Vector<std::string> v;
+    v.push_back("one");
+    v.push_back("two");
+
+    Vector<std::string> copy(v);
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy[1], "two");
+    EXPECT_TRUE(copy == v);
+
+    Vector<std::string> assigned;
+    assigned.push_back("old");
+    assigned = v;
+    assigned = assigned;
+    EXPECT_TRUE(assigned == v);
+    v.push_back("three");
+    EXPECT_EQ(assigned.size(), 2);
+}
+
+TEST(Vector, Swap)
+{
+    Vector<int> v1(3, 1);
+    Vector<int> v2(5, 2);
+    const int* data1 = &v1[0];
+    swap(v1, v2);
+    EXPECT_EQ(v1.size(), 5);
+    EXPECT_EQ(v2.size(), 3);
+    EXPECT_EQ(&v2[0], data1);
+}
+
+#if __cplusplus >= 201103L
+TEST(Vector, MoveConstructAndAssign)
+{
+    Vector<std::string> v(4, std::string("payload that is long enough to allocate"));
+    const std::string* data = &v[0];
+
+    Vector<std::string> moved(std::move(v));
+    EXPECT_EQ(moved.size(), 4);
+    EXPECT_EQ(&moved[0], data);
+    EXPECT_EQ(v.size(), 0);
+
+    Vector<std::string> assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(&assigned[0], data);
+    EXPECT_EQ(moved.size(), 0);
+}
+
+TEST(Vector, PushBackRvalueAndEmplace)
+{
+    Vector<std::string> v;
+    std::string s("a string long enough to live on the heap");
+    const char* chars = s.data();
+    v.push_back(std::move(s));
+    EXPECT_EQ(v[0].data(), chars);
+
+    v.emplace_back(3, 'x');
+    EXPECT_EQ(v[1], "xxx");
+    v.emplace(v.begin(), 2, 'y');
+    EXPECT_EQ(v[0], "yy");
+    EXPECT_EQ(v[2], "xxx");
+    v.emplace_back(v[0]);
+    EXPECT_EQ(v[3], "yy");
+}
+#endif
+
+TEST(Vector, RangeConstructorDispatch)
+{
+    Vector<long> filled(3, 7);
+    EXPECT_EQ(filled.size(), 3);
+    EXPECT_EQ(filled[2], 7);
+
+    std::list<std::string> words;
+    words.push_back("alpha");
+    words.push_back("beta");
+    Vector<std::string> fromList(words.begin(), words.end());
+    EXPECT_EQ(fromList.size(), 2);
+    EXPECT_EQ(fromList.capacity(), 2);
+    EXPECT_EQ(fromList[1], "beta");
+
+    std::istringstream in("1 2 3 4");
+    Vector<int> fromStream((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+    EXPECT_EQ(fromStream.size(), 4);
+    EXPECT_EQ(fromStream[3], 4);
+}
+
+TEST(Vector, InsertRangeInMiddle)
+{
+    Vector<int> v;
+    for (int i = 0; i < 6; ++i) {
+        v.push_back(i);
+    }
+    std::list<int> batch;
+    for (int i = 0; i < 1000; ++i) {
+        batch.push_back(100 + i);
+    }
+    v.insert(v.begin() + 3, batch.begin(), batch.end());
+    EXPECT_EQ(v.size(), 1006);
+    EXPECT_EQ(v[2], 2);
+    EXPECT_EQ(v[3], 100);
+    EXPECT_EQ(v[1002], 1099);
+    EXPECT_EQ(v[1003], 3);
+    EXPECT_EQ(v[1005], 5);
+
+    std::istringstream in("7 8");
+    v.insert(v.begin(), std::istream_iterator<int>(in), std::istream_iterator<int>());
+    EXPECT_EQ(v[0], 7);
+    EXPECT_EQ(v[1], 8);
+    EXPECT_EQ(v[2], 0);
+}
+
+TEST(Vector, InsertOwnRange)
+{
+    Vector<std::string> v;
+    v.push_back("a");
+    v.push_back("b");
+    v.insert(v.begin() + 1, v.begin(), v.end());
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v[1], "a");
+    EXPECT_EQ(v[2], "b");
+    EXPECT_EQ(v[3], "b");
+}
+
+TEST(SmallVector, StaysInlineThenSpills)
+{
+    SmallVector<int, 4> v;
+    EXPECT_EQ(v.capacity(), 4);
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_TRUE(v.isInline());
+    EXPECT_EQ(v.capacity(), 4);
+    EXPECT_GE(reinterpret_cast<const char*>(&v[0]), reinterpret_cast<const char*>(&v));
+    EXPECT_LT(reinterpret_cast<const char*>(&v[0]), reinterpret_cast<const char*>(&v + 1));
+
+    v.push_back(4);
+    EXPECT_FALSE(v.isInline());
+    EXPECT_EQ(v.capacity(), 8);
+    EXPECT_EQ(v[4], 4);
+    v.insert(v.begin(), -1);
+    EXPECT_EQ(v[0], -1);
+    EXPECT_EQ(v[5], 4);
+
+    int expected = 0;
+    for (SmallVector<int, 4>::iterator it = v.begin() + 1; it != v.end(); ++it) {
+        EXPECT_EQ(*it, expected++);
+    }
+}
+
+TEST(SmallVector, CopyAndSwap)
+{
+    SmallVector<std::string, 2> small;
+    small.push_back("a");
+    SmallVector<std::string, 2> big(5, std::string("b"));
+    EXPECT_FALSE(big.isInline());
+
+    SmallVector<std::string, 2> copy(small);
+    EXPECT_TRUE(copy.isInline());
+    EXPECT_EQ(copy[0], "a");
+
+    small.swap(big);
+    EXPECT_EQ(small.size(), 5);
+    EXPECT_EQ(big.size(), 1);
+    EXPECT_TRUE(big.isInline());
+    EXPECT_EQ(big[0], "a");
+    EXPECT_EQ(small[4], "b");
+
+    copy = small;
+    EXPECT_EQ(copy.size(), 5);
+}
+
+#if __cplusplus >= 201103L
+TEST(SmallVector, Move)
+{
+    SmallVector<std::string, 2> inlined;
+    inlined.push_back("x");
+    SmallVector<std::string, 2> moved(std::move(inlined));
+    EXPECT_TRUE(moved.isInline());
+    EXPECT_EQ(moved[0], "x");
+    EXPECT_EQ(inlined.size(), 0);
+
+    SmallVector<std::string, 2> heap(3, std::string("y"));
+    const std::string* data = &heap[0];
+    moved = std::move(heap);
+    EXPECT_EQ(&moved[0], data);
+    EXPECT_EQ(moved.size(), 3);
+}
+
+struct CopyOnlyElement
+{
+    CopyOnlyElement() {}
+    CopyOnlyElement(const CopyOnlyElement&) {}
+};
+
+TEST(Vector, NoexceptMoveFollowsAllocator)
+{
+    typedef Vector<CopyOnlyElement> Plain;
+    typedef SmallVector<CopyOnlyElement, 2> Small;
+    EXPECT_TRUE(std::is_nothrow_move_constructible<Plain>::value);
+    EXPECT_TRUE(noexcept(std::declval<Plain&>().swap(std::declval<Plain&>())));
+    /// Inline elements are copied one by one.
+    EXPECT_FALSE(std::is_nothrow_move_constructible<Small>::value);
+    EXPECT_FALSE(noexcept(std::declval<Small&>().swap(std::declval<Small&>())));
+    EXPECT_FALSE((std::is_nothrow_move_constructible<StaticVector<CopyOnlyElement, 2> >::value));
+    EXPECT_TRUE((std::is_nothrow_move_constructible<SmallVector<std::string, 2> >::value));
+    EXPECT_TRUE((std::is_nothrow_move_constructible<StaticVector<int, 2> >::value));
+}
+#endif
+
+TEST(StaticVector, FixedCapacity)
+{
+    StaticVector<int, 4, OverflowFail> v;
+    EXPECT_EQ(v.capacity(), 4);
+    EXPECT_EQ(v.max_size(), 4);
+    EXPECT_GE(reinterpret_cast<const char*>(&*v.begin()), reinterpret_cast<const char*>(&v));
+    EXPECT_LT(reinterpret_cast<const char*>(&*v.begin()), reinterpret_cast<const char*>(&v + 1));
+
+    EXPECT_TRUE(v.push_back(1));
+    EXPECT_TRUE(v.push_back(3));
+    EXPECT_TRUE(v.insert(v.begin() + 1, 2) != v.end());
+    EXPECT_TRUE(v.push_back(4));
+    EXPECT_TRUE(v.full());
+    EXPECT_FALSE(v.push_back(5));
+    EXPECT_TRUE(v.insert(v.begin(), 0) == v.end());
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(v[0], 1);
+    EXPECT_EQ(v[3], 4);
+    EXPECT_EQ(v.capacity(), 4);
+
+    v.erase(v.begin());
+    EXPECT_EQ(v[0], 2);
+    EXPECT_FALSE(v.resize(5));
+    EXPECT_EQ(v.size(), 3);
+}
+
+TEST(StaticVector, OverflowPolicies)
+{
+    const int values[] = { 10, 20, 30, 40 };
+
+    StaticVector<int, 5, OverflowFail> failing(2, 0);
+    EXPECT_FALSE(failing.insert(failing.begin() + 1, values, values + 4));
+    EXPECT_EQ(failing.size(), 2);
+    EXPECT_TRUE(failing.insert(failing.begin() + 1, values, values + 3));
+    EXPECT_EQ(failing.size(), 5);
+    EXPECT_EQ(failing[0], 0);
+    EXPECT_EQ(failing[1], 10);
+    EXPECT_EQ(failing[3], 30);
+    EXPECT_EQ(failing[4], 0);
+
+    StaticVector<int, 5, OverflowDrop> dropping(2, 0);
+    EXPECT_FALSE(dropping.insert(dropping.begin() + 1, values, values + 4));
+    EXPECT_EQ(dropping.size(), 5);
+    EXPECT_EQ(dropping[1], 10);
+    EXPECT_EQ(dropping[3], 30);
+    EXPECT_EQ(dropping[4], 0);
+    EXPECT_FALSE(dropping.push_back(1));
+}
+
+TEST(StaticVector, GrowingThroughBaseThrows)
+{
+    StaticVector<int, 4, OverflowFail> v(3, 1);
+    Vector<int, FixedBufferAllocator<int, 4> >& base = v;
+    EXPECT_THROW(base.resize(100), std::bad_alloc);
+    EXPECT_THROW(base.reserve(5), std::bad_alloc);
+    base.push_back(2);
+    EXPECT_THROW(base.push_back(3), std::bad_alloc);
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(v.capacity(), 4);
+    EXPECT_EQ(v[3], 2);
+}
+
+TEST(StaticVector, ResizeUninitializedAppliesPolicy)
+{
+    StaticVector<int, 4, OverflowFail> failing(2, 7);
+    EXPECT_FALSE(failing.resize_uninitialized(100));
+    EXPECT_EQ(failing.size(), 2);
+    EXPECT_EQ(failing.capacity(), 4);
+    EXPECT_TRUE(failing.resize_uninitialized(4));
+    EXPECT_EQ(failing.size(), 4);
+    EXPECT_EQ(failing[1], 7);
+
+    StaticVector<int, 4, OverflowDrop> dropping(2, 7);
+    EXPECT_FALSE(dropping.resize_uninitialized(100));
+    EXPECT_EQ(dropping.size(), 4);
+    EXPECT_EQ(dropping.capacity(), 4);
+}
+
+TEST(StaticVector, CopyAndCompare)
+{
+    StaticVector<std::string, 3> v;
+    v.push_back("a");
+    v.push_back("b");
+    StaticVector<std::string, 3> copy(v);
+    EXPECT_TRUE(copy == v);
+    copy.push_back("c");
+    EXPECT_TRUE(v != copy);
+    v.swap(copy);
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(copy.size(), 2);
+}
+
+TEST(Compare, IntegralLexicographic)
+{
+    Vector<int> a(1000, 5);
+    Vector<int> b(1000, 5);
+    EXPECT_TRUE(a == b);
+    EXPECT_FALSE(a < b);
+    EXPECT_TRUE(a <= b);
+
+    b.push_back(0);
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(a < b);
+
+    Vector<int> c(a);
+    Vector<int>::iterator it = c.begin() + 777;
+    *it = -1;
+    EXPECT_TRUE(c < a);
+    EXPECT_TRUE(a > c);
+    EXPECT_TRUE(c < b);
+
+    Vector<int> d(a);
+    it = d.begin() + 999;
+    *it = 256;
+    EXPECT_TRUE(a < d);
+}
+
+TEST(Compare, FloatingPoint)
+{
+    Vector<double> a(100, 1.5);
+    Vector<double> b(100, 1.5);
+    Vector<double>::iterator it = a.begin() + 50;
+    *it = 0.0;
+    it = b.begin() + 50;
+    *it = -0.0;
+    EXPECT_TRUE(a == b);
+
+    Vector<float> nan(37, 2.0f);
+    Vector<float>::iterator n = nan.begin() + 20;
+    *n = std::numeric_limits<float>::quiet_NaN();
+    EXPECT_FALSE(nan == nan);
+    Vector<float> larger(nan);
+    n = larger.begin() + 30;
+    *n = 3.0f;
+    EXPECT_TRUE(nan < larger);
+}
+
+TEST(Compare, NonArithmetic)
+{
+    Vector<std::string> a;
+    a.push_back("abc");
+    a.push_back("abd");
+    Vector<std::string> b(a);
+    EXPECT_TRUE(a == b);
+    Vector<std::string>::iterator it = b.begin() + 1;
+    *it = "abe";
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(b >= a);
+}
+
+TEST(Fill, PatternsAndSizes)
+{
+    for (int n = 0; n < 300; n += 7) {
+        Vector<double> d(n, 1.25);
+        Vector<int> z(n, 0);
+        Vector<short> s(n, static_cast<short>(0x0102));
+        EXPECT_EQ(d.size(), static_cast<Vector<double>::size_type>(n));
+        for (int i = 0; i < n; ++i) {
+            EXPECT_EQ(d[i], 1.25);
+            EXPECT_EQ(z[i], 0);
+            EXPECT_EQ(s[i], 0x0102);
+        }
+    }
+    Vector<int> v(3, 1);
+    v.insert(v.begin() + 1, 100, 7);
+    EXPECT_EQ(v.size(), 103);
+    EXPECT_EQ(v[0], 1);
+    EXPECT_EQ(v[100], 7);
+    EXPECT_EQ(v[101], 1);
+}
+
+TEST(Fill, ResizeUninitialized)
+{
+    Vector<char> buffer;
+    buffer.resize_uninitialized(4096);
+    EXPECT_EQ(buffer.size(), 4096);
+    EXPECT_GE(buffer.capacity(), 4096);
+    buffer.resize_uninitialized(10);
+    EXPECT_EQ(buffer.size(), 10);
+
+    Vector<std::string> strings;
+    strings.resize_uninitialized(3);
+    EXPECT_EQ(strings.size(), 3);
+    EXPECT_EQ(strings[2], "");
+}
+
+TEST(MmapAllocator, GrowsAcrossThreshold)
+{
+    typedef MmapAllocator<int, 4096> Allocator;
+    Vector<int, Allocator> v;
+    for (int i = 0; i < 200000; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_TRUE(Allocator::isMapped(v.capacity()));
+    EXPECT_EQ(v.capacity() * sizeof(int) % PageMapping::pageSize(), 0u);
+    for (int i = 0; i < 200000; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+    Vector<int, Allocator> copy(v);
+    EXPECT_TRUE(copy == v);
+    v.clear();
+    EXPECT_EQ(copy[199999], 199999);
+}
+
+TEST(MmapAllocator, RemapKeepsPages)
+{
+    const std::size_t oldBytes = PageMapping::roundUp(PageMapping::HUGE_PAGE_SIZE);
+    char* p = static_cast<char*>(PageMapping::map(oldBytes));
+    EXPECT_EQ(reinterpret_cast<std::size_t>(p) % PageMapping::HUGE_PAGE_SIZE, 0u);
+    p[0] = 'a';
+    p[oldBytes - 1] = 'z';
+    char* q = static_cast<char*>(PageMapping::remap(p, oldBytes, 4 * oldBytes));
+    ASSERT_TRUE(q != NULL);
+    EXPECT_EQ(q[0], 'a');
+    EXPECT_EQ(q[oldBytes - 1], 'z');
+    q[4 * oldBytes - 1] = '!';
+    PageMapping::unmap(q, 4 * oldBytes);
+}
+
+TEST(MallocAllocator, ReallocGrowth)
+{
+    Vector<double, MallocAllocator<double> > v;
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(i * 0.5);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(v[i], i * 0.5);
+    }
+}
+
+TEST(MappedVector, PersistsAcrossOpens)
+{
+    const std::string path = ::testing::TempDir() + "mapped_vector_utest.bin";
+    std::remove(path.c_str());
+    {
+        MappedVector<long> v(path.c_str());
+        EXPECT_EQ(v.size(), 0);
+        for (long i = 0; i < 100000; ++i) {
+            v.push_back(i * 3);
+        }
+    }
+    {
+        MappedVector<long> v(path.c_str(), true);
+        ASSERT_EQ(v.size(), 100000);
+        EXPECT_GE(v.capacity(), 100000);
+        EXPECT_EQ(v[0], 0);
+        EXPECT_EQ(v[99999], 299997);
+        v.pop_back();
+        v.push_back(-1);
+        v.sync();
+    }
+    {
+        MappedVector<long> v(path.c_str(), true);
+        EXPECT_EQ(v[99999], -1);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(MappedVector, RejectsMismatchedFiles)
+{
+    const std::string path = ::testing::TempDir() + "mapped_vector_utest_bad.bin";
+    std::remove(path.c_str());
+    {
+        MappedVector<int> v(path.c_str());
+        v.push_back(1);
+    }
+    EXPECT_THROW(MappedVector<double> wrongType(path.c_str()), std::runtime_error);
+    {
+        std::FILE* file = std::fopen(path.c_str(), "r+b");
+        std::fseek(file, MappedFile::HEADER_SIZE, SEEK_SET);
+        std::fputc(7, file);
+        std::fclose(file);
+    }
+    EXPECT_THROW(MappedVector<int> corrupted(path.c_str(), true), std::runtime_error);
+    {
+        /// capacity * sizeof(int) wraps around to 0.
+        const unsigned long long capacity = 1ULL << 62;
+        std::FILE* file = std::fopen(path.c_str(), "r+b");
+        std::fseek(file, 24, SEEK_SET);
+        std::fwrite(&capacity, sizeof(capacity), 1, file);
+        std::fclose(file);
+    }
+    EXPECT_THROW(MappedVector<int> huge(path.c_str()), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(VectorIO, StreamRoundTrip)
+{
+    Vector<double> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i / 7.0);
+    }
+    std::stringstream buffer;
+    writeBinary(buffer, v);
+    EXPECT_EQ(buffer.str().size(), BinaryHeader::SIZE + 1000 * sizeof(double));
+    Vector<double> w(5, 1.0);
+    readBinary(buffer, w);
+    EXPECT_TRUE(v == w);
+
+    std::stringstream wrongType(buffer.str());
+    Vector<float> f;
+    EXPECT_THROW(readBinary(wrongType, f), std::runtime_error);
+    std::stringstream truncated(buffer.str().substr(0, 100));
+    EXPECT_THROW(readBinary(truncated, w), std::runtime_error);
+    EXPECT_EQ(w.size(), 0);
+}
+
+TEST(VectorIO, FileDescriptorRoundTrip)
+{
+    const std::string path = ::testing::TempDir() + "vector_io_utest.bin";
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd, 0);
+    Vector<int> v;
+    for (int i = 0; i < 5000; ++i) {
+        v.push_back(i * i);
+    }
+    writeBinary(fd, v);
+    writeBinary(fd, Vector<int>());
+    ::lseek(fd, 0, SEEK_SET);
+    Vector<int> w;
+    readBinary(fd, w);
+    EXPECT_TRUE(v == w);
+    readBinary(fd, w);
+    EXPECT_EQ(w.size(), 0);
+    ::close(fd);
+    std::remove(path.c_str());
+}
+
+TEST(VectorIO, ChunkedStream)
+{
+    std::stringstream buffer;
+    BinaryChunkWriter<int> writer(buffer);
+    Vector<int> chunk;
+    for (int c = 0; c < 4; ++c) {
+        chunk.clear();
+        for (int i = 0; i < 100; ++i) {
+            chunk.push_back(c * 100 + i);
+        }
+        writer.write(chunk);
+    }
+    writer.finish();
+
+    const std::string bytes = buffer.str();
+    std::stringstream whole(bytes);
+    Vector<int> all;
+    readBinary(whole, all);
+    ASSERT_EQ(all.size(), 400);
+    EXPECT_EQ(all[399], 399);
+
+    std::stringstream pieces(bytes);
+    BinaryChunkReader<int> reader(pieces, 64);
+    int expected = 0;
+    while (reader.read(chunk)) {
+        EXPECT_LE(chunk.size(), 64);
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            EXPECT_EQ(chunk[i], expected++);
+        }
+    }
+    EXPECT_EQ(expected, 400);
+}
+
+/// std::allocator that counts its allocate calls.
+template <typename T>
+struct CountingAllocator : std::allocator<T>
+{
+    template <typename U> struct rebind { typedef CountingAllocator<U> other; };
+    CountingAllocator() {}
+    template <typename U> CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(const std::size_t n, const void* = 0)
+    {
+        if (__atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED) > limit) {
+            throw std::bad_alloc();
+        }
+        return std::allocator<T>::allocate(n);
+    }
+
+    static int allocations;
+    /// Allocations past this many throw.
+    static int limit;
+};
+template <typename T> int CountingAllocator<T>::allocations = 0;
+template <typename T> int CountingAllocator<T>::limit = std::numeric_limits<int>::max();
+
+TEST(VectorIO, ManySmallChunksGrowGeometrically)
+{
+    std::stringstream buffer;
+    BinaryChunkWriter<int> writer(buffer);
+    Vector<int> chunk;
+    for (int c = 0; c < 3000; ++c) {
+        chunk.clear();
+        chunk.push_back(2 * c);
+        chunk.push_back(2 * c + 1);
+        writer.write(chunk);
+    }
+    writer.finish();
+
+    Vector<int, CountingAllocator<int> > all;
+    CountingAllocator<int>::allocations = 0;
+    readBinary(buffer, all);
+    ASSERT_EQ(all.size(), 6000);
+    for (int i = 0; i < 6000; ++i) {
+        ASSERT_EQ(all[i], i);
+    }
+    EXPECT_LE(CountingAllocator<int>::allocations, 16);
+}
+
+TEST(VectorIO, ForeignByteOrder)
+{
+    char header[BinaryHeader::SIZE];
+    BinaryHeader(sizeof(int), 2).encode(header);
+    for (int field = 8; field < 24; field += 4) {
+        std::reverse(header + field, header + field + 4);
+    }
+    std::reverse(header + 24, header + 32);
+    const char payload[] = { 0, 0, 0, 1, 0, 0, 1, 0 };
+    std::stringstream buffer(std::string(header, sizeof(header)) + std::string(payload, sizeof(payload)));
+    Vector<int> v;
+    readBinary(buffer, v);
+    ASSERT_EQ(v.size(), 2);
+    EXPECT_EQ(v[0], 1);
+    EXPECT_EQ(v[1], 256);
+}
+
+TEST(VectorText, IntegerRoundTrip)
+{
+    Vector<long long> v;
+    v.push_back(0);
+    v.push_back(-7);
+    v.push_back(1234567890123LL);
+    v.push_back(std::numeric_limits<long long>::min());
+    v.push_back(std::numeric_limits<long long>::max());
+    std::stringstream text;
+    writeText(text, v, ',');
+    EXPECT_EQ(text.str(), "0,-7,1234567890123,-9223372036854775808,9223372036854775807\n");
+    Vector<long long> w;
+    EXPECT_EQ(readText(text, w), 5);
+    EXPECT_TRUE(v == w);
+
+    Vector<unsigned char> bytes;
+    const std::string csv = "1, 2;255\r\n";
+    EXPECT_EQ(parseText(csv.data(), csv.data() + csv.size(), bytes), 3);
+    EXPECT_EQ(bytes[2], 255);
+    const std::string overflow = "256";
+    EXPECT_THROW(parseText(overflow.data(), overflow.data() + overflow.size(), bytes), std::runtime_error);
+    const std::string garbage = "12 3x4";
+    EXPECT_THROW(parseText(garbage.data(), garbage.data() + garbage.size(), bytes), std::runtime_error);
+}
+
+TEST(VectorText, FloatRoundTripIsExact)
+{
+    Vector<double> v;
+    v.push_back(0.1);
+    v.push_back(-1.0 / 3.0);
+    v.push_back(1e300);
+    v.push_back(std::numeric_limits<double>::denorm_min());
+    v.push_back(std::numeric_limits<double>::infinity());
+    Vector<float> f;
+    f.push_back(0.1f);
+    f.push_back(-3.4e38f);
+    std::stringstream text;
+    writeText(text, v);
+    writeText(text, f);
+    Vector<double> w;
+    Vector<float> g;
+    const std::string line = text.str();
+    const std::string::size_type newline = line.find('\n');
+    parseText(line.data(), line.data() + newline, w);
+    parseText(line.data() + newline, line.data() + line.size(), g);
+    EXPECT_TRUE(v == w);
+    EXPECT_TRUE(f == g);
+}
+
+TEST(FloatText, ShortestDigits)
+{
+    const double doubles[] = { 0.1, 100.0, 1e21, 1e22, 123.456, 5e-324, -0.0, 1.7976931348623157e308, 9007199254740993.0 };
+    const char* const expected[] = { "0.1", "100", "1e+21", "1e+22", "123.456", "5e-324", "-0", "1.7976931348623157e+308", "9007199254740992" };
+    for (std::size_t i = 0; i < sizeof(doubles) / sizeof(doubles[0]); ++i) {
+        char text[FloatText::MAX_SIZE];
+        EXPECT_EQ(std::string(expected[i]), std::string(text, FloatText::format(doubles[i], text)));
+    }
+    char text[FloatText::MAX_SIZE];
+    EXPECT_EQ("0.1", std::string(text, FloatText::format(0.1f, text)));
+    EXPECT_EQ("3.4028235e+38", std::string(text, FloatText::format(std::numeric_limits<float>::max(), text)));
+    EXPECT_EQ("-inf", std::string(text, FloatText::format(-std::numeric_limits<double>::infinity(), text)));
+}
+
+TEST(FloatText, ParsesCorrectlyRounded)
+{
+    const char* const inputs[] = {
+        "0.1000000000000000055511151231257827021181583404541015625",
+        "9007199254740993",
+        "9007199254740993.000000000000000000000000001",
+        "2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125e-324",
+        ".5e1", "+1E+2", "-0", "1e", "Infinity", "NaN", "1e400", "x"
+    };
+    const double expected[] = { 0.1, 9007199254740992.0, 9007199254740994.0, 0.0, 5.0, 100.0, -0.0, 1.0, 0.0, 0.0, 0.0, 0.0 };
+    const std::size_t consumed[] = { 57, 16, 44, 758, 4, 5, 2, 1, 8, 3, 0, 0 };
+    for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+        const std::string input = inputs[i];
+        double value = 0.0;
+        const char* end = FloatText::parse(input.data(), input.data() + input.size(), value);
+        if (0 == consumed[i]) {
+            EXPECT_TRUE(NULL == end) << input;
+            continue;
+        }
+        ASSERT_TRUE(NULL != end) << input;
+        EXPECT_EQ(consumed[i], static_cast<std::size_t>(end - input.data())) << input;
+        if (8 == i) {
+            EXPECT_EQ(std::numeric_limits<double>::infinity(), value);
+        } else if (9 == i) {
+            EXPECT_NE(value, value);
+        } else {
+            EXPECT_EQ(0, ::memcmp(&expected[i], &value, sizeof(value))) << input;
+        }
+    }
+}
+
+TEST(FloatText, RandomBitsRoundTrip)
+{
+    unsigned long long state = 88172645463325252ULL;
+    for (int i = 0; i < 100000; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double d;
+        ::memcpy(&d, &state, sizeof(d));
+        const unsigned int low = static_cast<unsigned int>(state);
+        float f;
+        ::memcpy(&f, &low, sizeof(f));
+        char text[FloatText::MAX_SIZE];
+        char* end = FloatText::format(d, text);
+        double e = 0.0;
+        if (d == d) {
+            ASSERT_EQ(end, FloatText::parse(text, end, e));
+            ASSERT_EQ(0, ::memcmp(&d, &e, sizeof(d))) << std::string(text, end);
+        }
+        end = FloatText::format(f, text);
+        float g = 0.0f;
+        if (f == f) {
+            ASSERT_EQ(end, FloatText::parse(text, end, g));
+            ASSERT_EQ(0, ::memcmp(&f, &g, sizeof(f))) << std::string(text, end);
+        }
+    }
+}
+
+TEST(FloatText, IgnoresNumericLocale)
+{
+    const char* const names[] = { "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "ru_RU.UTF-8" };
+    for (std::size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i) {
+        if (NULL != ::setlocale(LC_NUMERIC, names[i])) {
+            break;
+        }
+    }
+    Vector<double> v;
+    v.push_back(0.5);
+    v.push_back(-1.25e-10);
+    std::stringstream text;
+    writeText(text, v);
+    EXPECT_EQ(std::string::npos, text.str().find(','));
+    Vector<double> w;
+    const std::string line = text.str();
+    parseText(line.data(), line.data() + line.size(), w);
+    ::setlocale(LC_NUMERIC, "C");
+    EXPECT_TRUE(v == w);
+}
+
+TEST(VectorText, LargeStreamAcrossBlocks)
+{
+    Vector<int> v;
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(i * 7919 - 300000000);
+    }
+    std::stringstream text;
+    writeText(text, v, '\n');
+    EXPECT_GT(text.str().size(), 2 * TextReader::BUFFER_SIZE);
+    Vector<int> w;
+    EXPECT_EQ(readText(text, w), 100000);
+    EXPECT_TRUE(v == w);
+}
+
+struct Increment
+{
+    void operator()(long& x) const { ++x; }
+};
+
+struct Square
+{
+    long operator()(const long x) const { return x * x; }
+};
+
+struct Plus
+{
+    long operator()(const long a, const long b) const { return a + b; }
+};
+
+struct NestedSum
+{
+    explicit NestedSum(ThreadPool& pool) : pool_(pool) {}
+    void operator()(Vector<long>& row) const
+    {
+        const long total = parallel_reduce(row, 0L, Plus(), 2, &pool_);
+        *(row.begin()) = total;
+    }
+    ThreadPool& pool_;
+};
+
+TEST(Parallel, ForEachTransformReduce)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+    Vector<long> v;
+    for (long i = 0; i < 100000; ++i) {
+        v.push_back(i);
+    }
+    parallel_for_each(v, Increment(), 1000, &pool);
+    EXPECT_EQ(v[0], 1);
+    EXPECT_EQ(v[99999], 100000);
+
+    Vector<long> squares;
+    parallel_transform(v, squares, Square(), 777, &pool);
+    ASSERT_EQ(squares.size(), v.size());
+    EXPECT_EQ(squares[99999], 100000L * 100000L);
+
+    EXPECT_EQ(parallel_reduce(v, 0L, Plus(), 333, &pool), 100000L * 100001L / 2);
+    EXPECT_EQ(parallel_reduce(v, 5L, Plus(), 1000000, &pool), 100000L * 100001L / 2 + 5);
+    EXPECT_EQ(parallel_reduce(Vector<long>(), 7L, Plus(), 10, &pool), 7);
+}
+
+TEST(Parallel, InclusiveScanMatchesSequential)
+{
+    ThreadPool pool(3);
+    std::vector<long> input;
+    for (long i = 0; i < 12345; ++i) {
+        input.push_back(i % 17 - 8);
+    }
+    std::vector<long> output(input.size());
+    parallel_inclusive_scan(input.begin(), input.end(), output.begin(), Plus(), 100, &pool);
+    Vector<long> inPlace(input.begin(), input.end());
+    parallel_inclusive_scan(inPlace, Plus(), 64, &pool);
+    long sum = 0;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        sum += input[i];
+        ASSERT_EQ(output[i], sum);
+        ASSERT_EQ(inPlace[i], sum);
+    }
+}
+
+TEST(Parallel, NestedCallsAndVectorIterators)
+{
+    ThreadPool pool(4);
+    Vector<Vector<long> > rows;
+    for (int r = 0; r < 16; ++r) {
+        rows.push_back(Vector<long>(100, static_cast<long>(r)));
+    }
+    parallel_for_each(rows.begin(), rows.end(), NestedSum(pool), 1, &pool);
+    for (int r = 0; r < 16; ++r) {
+        EXPECT_EQ(rows[r][0], 100 * r);
+    }
+}
+
+struct ThrowOnSeven
+{
+    void operator()(const long x) const
+    {
+        if (7 == x) {
+            throw std::logic_error("seven");
+        }
+    }
+};
+
+TEST(Parallel, TaskFailureIsReported)
+{
+    ThreadPool pool(2);
+    Vector<long> v;
+    for (long i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+#if __cplusplus >= 201103L
+    EXPECT_THROW(parallel_for_each(v, ThrowOnSeven(), 5, &pool), std::logic_error);
+#else
+    EXPECT_THROW(parallel_for_each(v, ThrowOnSeven(), 5, &pool), std::runtime_error);
+#endif
+    EXPECT_EQ(parallel_reduce(v, 0L, Plus(), 5, &pool), 4950);
+}
+
+/// Chunk 0 fails; the others wait for that so that none finishes first.
+struct FailFirstChunk : ThreadPool::Task
+{
+    FailFirstChunk() : failed(false), ran(0) {}
+    void run(const std::size_t chunk)
+    {
+        if (0 == chunk) {
+            __atomic_store_n(&failed, true, __ATOMIC_RELEASE);
+            throw std::logic_error("first");
+        }
+        while (!__atomic_load_n(&failed, __ATOMIC_ACQUIRE)) {
+            ::sched_yield();
+        }
+        __atomic_add_fetch(&ran, 1, __ATOMIC_RELAXED);
+    }
+    bool failed;
+    int ran;
+};
+
+TEST(Parallel, FailureStopsHandingOutChunks)
+{
+    ThreadPool pool(2);
+    FailFirstChunk task;
+    try {
+        pool.run(task, 1000);
+        FAIL();
+    } catch (const std::exception& e) {
+        EXPECT_EQ(std::string("first"), e.what());
+    }
+    EXPECT_LT(task.ran, static_cast<int>(pool.size()));
+}
+
+TEST(ConcurrentVector, SegmentLayout)
+{
+    typedef ConcurrentVector<int> CV;
+    EXPECT_EQ(CV::segmentOf(0), 0u);
+    EXPECT_EQ(CV::segmentOf(CV::FIRST_SEGMENT - 1), 0u);
+    EXPECT_EQ(CV::segmentOf(CV::FIRST_SEGMENT), 1u);
+    EXPECT_EQ(CV::segmentOf(2 * CV::FIRST_SEGMENT - 1), 1u);
+    EXPECT_EQ(CV::segmentOf(2 * CV::FIRST_SEGMENT), 2u);
+    EXPECT_EQ(CV::segmentBase(3), 4 * CV::FIRST_SEGMENT);
+    EXPECT_EQ(CV::segmentSize(3), 4 * CV::FIRST_SEGMENT);
+
+    CV v;
+    v.reserve(100);
+    EXPECT_GE(v.capacity(), 100u);
+    EXPECT_EQ(v.push_back(5), 0u);
+    const int* first = &v[0];
+    for (int i = 1; i < 10000; ++i) {
+        EXPECT_EQ(v.push_back(i), static_cast<CV::size_type>(i));
+    }
+    EXPECT_EQ(first, &v[0]);
+    EXPECT_EQ(v.size(), 10000u);
+    EXPECT_EQ(std::distance(v.begin(), v.end()), 10000);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    v.push_back(1);
+    EXPECT_EQ(v[0], 1);
+}
+
+typedef ConcurrentVector<std::string, CountingAllocator<std::string> > ProducedStrings;
+
+struct ConcurrentProducer
+{
+    ProducedStrings* target;
+    int id;
+};
+
+void*
+produceStrings(void* argument)
+{
+    ConcurrentProducer* producer = static_cast<ConcurrentProducer*>(argument);
+    for (int i = 0; i < 2000; ++i) {
+        std::ostringstream text;
+        text << producer->id * 2000 + i;
+        producer->target->push_back(text.str());
+        const ProducedStrings::size_type published = producer->target->size();
+        if (published != 0 && (*producer->target)[published - 1].empty()) {
+            return producer;
+        }
+    }
+    return NULL;
+}
+
+TEST(ConcurrentVector, ManyProducers)
+{
+    CountingAllocator<std::string>::allocations = 0;
+    CountingAllocator<char>::allocations = 0;
+    ProducedStrings v;
+    const int threads = 8;
+    pthread_t ids[threads];
+    ConcurrentProducer producers[threads];
+    for (int t = 0; t < threads; ++t) {
+        producers[t].target = &v;
+        producers[t].id = t;
+        ASSERT_EQ(pthread_create(&ids[t], NULL, produceStrings, &producers[t]), 0);
+    }
+    for (int t = 0; t < threads; ++t) {
+        void* failed = NULL;
+        pthread_join(ids[t], &failed);
+        EXPECT_TRUE(NULL == failed);
+    }
+    ASSERT_EQ(v.size(), static_cast<std::size_t>(threads * 2000));
+    std::vector<bool> seen(threads * 2000, false);
+    for (ProducedStrings::const_iterator it = v.begin(); it != v.end(); ++it) {
+        const int value = std::atoi(it->c_str());
+        EXPECT_FALSE(seen[value]);
+        seen[value] = true;
+    }
+    /// One allocation of storage and of flags per segment, however many
+    /// producers reached it together.
+    const int segments = static_cast<int>(ProducedStrings::segmentOf(threads * 2000 - 1)) + 1;
+    EXPECT_EQ(CountingAllocator<std::string>::allocations, segments);
+    EXPECT_EQ(CountingAllocator<char>::allocations, segments);
+}
+
+TEST(ConcurrentVector, FailedSegmentAllocationIsRetried)
+{
+    typedef ConcurrentVector<int, CountingAllocator<int> > CV;
+    CV v;
+    CountingAllocator<int>::allocations = 0;
+    CountingAllocator<int>::limit = 1;
+    for (int i = 0; i < 8; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_THROW(v.push_back(8), std::bad_alloc);
+    EXPECT_EQ(v.capacity(), 8u);
+    CountingAllocator<int>::limit = std::numeric_limits<int>::max();
+    /// The failed push_back claimed no slot.
+    EXPECT_EQ(v.push_back(9), 8u);
+    EXPECT_EQ(v.capacity(), 16u);
+    ASSERT_EQ(v.size(), 9u);
+    EXPECT_EQ(v[8], 9);
+    EXPECT_EQ(*--v.end(), 9);
+}
+
+struct ThrowingCopy
+{
+    explicit ThrowingCopy(const int value) : value(value) {}
+    ThrowingCopy(const ThrowingCopy& rhv) : value(rhv.value)
+    {
+        if (value < 0) {
+            throw std::runtime_error("copy");
+        }
+    }
+    int value;
+};
+
+TEST(ConcurrentVector, FailedCopyIsSkipped)
+{
+    ConcurrentVector<ThrowingCopy> v;
+    v.push_back(ThrowingCopy(0));
+    EXPECT_THROW(v.push_back(ThrowingCopy(-1)), std::runtime_error);
+    ConcurrentVector<ThrowingCopy>::const_iterator end = v.end();
+    EXPECT_THROW(v.push_back(ThrowingCopy(-2)), std::runtime_error);
+    EXPECT_EQ(v.push_back(ThrowingCopy(3)), 3u);
+    /// Failed slots count in size() so that later elements get published.
+    EXPECT_EQ(v.size(), 4u);
+    EXPECT_EQ(v[3].value, 3);
+    std::vector<int> values;
+    for (ConcurrentVector<ThrowingCopy>::const_iterator it = v.begin(); it != v.end(); ++it) {
+        values.push_back(it->value);
+    }
+    ASSERT_EQ(values.size(), 2u);
+    EXPECT_EQ(values[0], 0);
+    EXPECT_EQ(values[1], 3);
+    /// An end() taken before slot 2 failed still ends the first element.
+    EXPECT_TRUE(++v.begin() == end);
+    EXPECT_EQ(std::distance(v.begin(), v.end()), 2);
+    v.clear();
+    EXPECT_TRUE(v.begin() == v.end());
+}
+
+TEST(SegmentedVector, GrowthKeepsReferences)
+{
+    SegmentedVector<std::string, 4> v;
+    v.push_back("first");
+    const std::string* first = &v.front();
+    SegmentedVector<std::string, 4>::iterator it = v.begin();
+    for (int i = 1; i < 100; ++i) {
+        std::ostringstream text;
+        text << i;
+        v.push_back(text.str());
+    }
+    EXPECT_EQ(first, &v[0]);
+    EXPECT_EQ(*it, "first");
+    EXPECT_EQ(v.size(), 100u);
+    EXPECT_EQ(v.blockCount(), 25u);
+    EXPECT_EQ(v.back(), "99");
+
+    v.resize(10);
+    EXPECT_EQ(v.size(), 10u);
+    EXPECT_EQ(v.capacity(), 100u);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 12u);
+    EXPECT_EQ(first, &v[0]);
+}
+
+TEST(SegmentedVector, FailedBlockAllocationKeepsDirectory)
+{
+    typedef SegmentedVector<int, 4, CountingAllocator<int> > SV;
+    SV v;
+    CountingAllocator<int>::allocations = 0;
+    CountingAllocator<int>::limit = 3;
+    for (int i = 0; i < 12; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_THROW(v.push_back(12), std::bad_alloc);
+    CountingAllocator<int>::limit = std::numeric_limits<int>::max();
+    EXPECT_EQ(v.blockCount(), 3u);
+    EXPECT_EQ(v.size(), 12u);
+    for (int i = 12; i < 1000; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(v.blockCount(), 250u);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+}
+
+TEST(SegmentedVector, RandomAccessIterators)
+{
+    SegmentedVector<int, 8> v;
+    for (int i = 0; i < 50; ++i) {
+        v.push_back(49 - i);
+    }
+    std::sort(v.begin(), v.end());
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(v[i], i);
+    }
+    SegmentedVector<int, 8>::const_iterator cit = v.begin();
+    EXPECT_EQ(*(cit + 17), 17);
+    EXPECT_EQ(v.end() - v.begin(), 50);
+    EXPECT_EQ(*std::lower_bound(v.begin(), v.end(), 33), 33);
+
+    SegmentedVector<int, 8> copy(v);
+    EXPECT_TRUE(copy == v);
+    copy.pop_back();
+    EXPECT_TRUE(copy != v);
+    copy = v;
+    EXPECT_TRUE(copy == v);
+}
+
+TEST(SoaVector, ColumnsStayAligned)
+{
+    SoaVector<int, double, std::string> records;
+    for (int i = 0; i < 10; ++i) {
+        std::ostringstream name;
+        name << "r" << i;
+        records.push_back(i, i * 0.5, name.str());
+    }
+    EXPECT_EQ(records.size(), 10u);
+    EXPECT_EQ(records.column<1>().size(), 10u);
+    EXPECT_EQ(records.get<2>(3), "r3");
+
+    records.erase(2);
+    records.erase(0, 1);
+    EXPECT_EQ(records.size(), 8u);
+    EXPECT_EQ(records.get<0>(0), 1);
+    EXPECT_EQ(records.get<0>(1), 3);
+    EXPECT_EQ(records.get<2>(1), "r3");
+
+    double sum = 0;
+    for (Vector<double>::const_iterator it = records.column<1>().begin(); it != records.column<1>().end(); ++it) {
+        sum += *it;
+    }
+    EXPECT_EQ(sum, (1 + 3 + 4 + 5 + 6 + 7 + 8 + 9) * 0.5);
+
+    for (SoaVector<int, double, std::string>::field<0>::iterator it = records.begin<0>(); it != records.end<0>(); ++it) {
+        *it *= 10;
+    }
+    records.set<1>(0, -1.0);
+    EXPECT_EQ(records.get<0>(7), 90);
+    EXPECT_EQ(records.get<1>(0), -1.0);
+
+    records.resize(12, 7, 7.5, "new");
+    EXPECT_EQ(records.get<2>(11), "new");
+    records.resize(3);
+    EXPECT_EQ(records.column<2>().size(), 3u);
+    records.pop_back();
+    EXPECT_EQ(records.size(), 2u);
+
+    SoaVector<int, double, std::string> other;
+    other.swap(records);
+    EXPECT_TRUE(records.empty());
+    EXPECT_TRUE(other != records);
+    records = other;
+    EXPECT_TRUE(other == records);
+}
+
+#ifdef VECTOR_STATS_ENABLED
+TEST(VectorStats, CountsGrowthCopiesAndShifts)
+{
+    VectorStats::reset();
+    {
+        Vector<short> v;
+        for (short i = 0; i < 100; ++i) {
+            v.push_back(i);
+        }
+        v.insert(v.begin(), 5);
+        v.erase(v.begin());
+        Vector<short> copy(v);
+        v.resize(10);
+    }
+    const VectorStatsCounters& stats = VectorStats::of<Vector<short> >();
+    EXPECT_EQ(stats.elementSize, sizeof(short));
+    EXPECT_EQ(stats.growths, 9u);
+    EXPECT_EQ(stats.implicitGrowths, 8u);
+    EXPECT_EQ(stats.bytesRelocated, 127 * sizeof(short));
+    EXPECT_EQ(stats.bytesCopied, 100 * sizeof(short));
+    EXPECT_EQ(stats.elementsShifted, 200u);
+    EXPECT_EQ(stats.resizes, 1u);
+    EXPECT_EQ(stats.destroyed, 2u);
+    EXPECT_EQ(stats.wastedBytes, 118 * sizeof(short));
+    EXPECT_EQ(stats.sizeHistogram[4], 1u);
+    EXPECT_EQ(stats.sizeHistogram[7], 1u);
+    EXPECT_EQ(stats.fillHistogram[0], 1u);
+    EXPECT_EQ(stats.fillHistogram[10], 1u);
+}
+
+void
+recordGrowth(const VectorGrowthEvent& event, void* context)
+{
+    static_cast<std::vector<VectorGrowthEvent>*>(context)->push_back(event);
+}
+
+TEST(VectorStats, GrowthCallbackAndReport)
+{
+    std::vector<VectorGrowthEvent> events;
+    VectorStats::setGrowthCallback(recordGrowth, &events);
+    Vector<unsigned short> v;
+    v.reserve(10);
+    for (unsigned short i = 0; i < 11; ++i) {
+        v.push_back(i);
+    }
+    VectorStats::setGrowthCallback(NULL);
+    v.reserve(100);
+
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].vector, &v);
+    EXPECT_EQ(events[0].oldCapacity, 0u);
+    EXPECT_EQ(events[0].newCapacity, 10u);
+    EXPECT_EQ(events[1].size, 10u);
+    EXPECT_EQ(events[1].newCapacity, 20u);
+    EXPECT_EQ(events[1].stats, &VectorStats::of<Vector<unsigned short> >());
+
+    std::ostringstream report;
+    VectorStats::report(report);
+    EXPECT_NE(report.str().find("Vector<unsigned short"), std::string::npos);
+}
+#else
+TEST(VectorStats, DisabledBuildCountsNothing)
+{
+    Vector<short> v;
+    for (short i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(VectorStats::of<Vector<short> >().growths, 0u);
+}
+#endif
+
+TEST(Shrink, ShrinkToFit)
+{
+    Vector<int> v;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    v.erase(v.begin() + 10, v.end());
+    EXPECT_EQ(v.capacity(), 128u);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 10u);
+    EXPECT_EQ(v[9], 9);
+    v.clear();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 0u);
+    v.push_back(1);
+    EXPECT_EQ(v[0], 1);
+
+    Vector<std::string> strings(20, std::string("shrink"));
+    strings.resize(3);
+    strings.shrink_to_fit();
+    EXPECT_EQ(strings.capacity(), 3u);
+    EXPECT_EQ(strings[2], "shrink");
+
+    Vector<long, MallocAllocator<long> > reallocated(1000, 5L);
+    reallocated.resize(10);
+    reallocated.shrink_to_fit();
+    EXPECT_LT(reallocated.capacity(), 1000u);
+    EXPECT_EQ(reallocated[9], 5L);
+
+    SmallVector<int, 4> small;
+    for (int i = 0; i < 10; ++i) {
+        small.push_back(i);
+    }
+    small.resize(3);
+    small.shrink_to_fit();
+    EXPECT_EQ(small.capacity(), 4u);
+    EXPECT_EQ(small[2], 2);
+
+    StaticVector<int, 8> fixed;
+    fixed.push_back(7);
+    fixed.shrink_to_fit();
+    EXPECT_EQ(fixed.capacity(), 8u);
+    EXPECT_EQ(fixed[0], 7);
+}
+
+TEST(Shrink, PolicyHysteresis)
+{
+    typedef ShrinkingGrowth<DoublingGrowth, 4, 64> Policy;
+    EXPECT_EQ(Policy::shrink(64, 15, 4), 30u);
+    EXPECT_EQ(Policy::shrink(64, 16, 4), 64u);
+    EXPECT_EQ(Policy::shrink(16, 1, 4), 16u);
+    EXPECT_EQ(Policy::shrink(64, 1, 4), 16u);
+    EXPECT_EQ(Policy::grow(8, 9, 4), 16u);
+
+    Vector<int, std::allocator<int>, Policy> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(v.capacity(), 1024u);
+    while (v.size() > 255) {
+        v.pop_back();
+    }
+    EXPECT_EQ(v.capacity(), 510u);
+    for (int round = 0; round < 10; ++round) {
+        while (v.size() < 510) {
+            v.push_back(round);
+        }
+        v.erase(v.begin() + 128, v.end());
+        EXPECT_EQ(v.capacity(), 510u);
+    }
+    EXPECT_EQ(v[127], 127);
+    v.resize(100);
+    EXPECT_EQ(v.capacity(), 200u);
+    v.clear();
+    EXPECT_EQ(v.capacity(), 16u);
+}
+
+TEST(AlignedAllocator, AlignsAndPadsBuffers)
+{
+    Vector<float, AlignedAllocator<float, 32, false> > simd;
+    for (int i = 0; i < 100; ++i) {
+        simd.push_back(static_cast<float>(i));
+        EXPECT_EQ(reinterpret_cast<std::size_t>(&*simd.begin()) % 32, 0u);
+    }
+    EXPECT_EQ(simd.capacity(), 128u);
+    EXPECT_EQ(simd[99], 99.0f);
+
+    Vector<char, AlignedAllocator<char> > padded;
+    padded.push_back('a');
+    EXPECT_EQ(padded.capacity(), 64u);
+    EXPECT_EQ(reinterpret_cast<std::size_t>(&*padded.begin()) % 64, 0u);
+    padded.resize(65, 'b');
+    EXPECT_EQ(padded.capacity(), 128u);
+
+    Vector<double, AlignedAllocator<double, 16> > line(3, 1.5);
+    EXPECT_EQ(line.capacity(), 8u);
+    EXPECT_EQ(reinterpret_cast<std::size_t>(&*line.begin()) % 64, 0u);
+
+    Vector<std::string, AlignedAllocator<std::string, 128> > strings(5, std::string("aligned"));
+    strings.push_back("more");
+    EXPECT_EQ(reinterpret_cast<std::size_t>(&*strings.begin()) % 128, 0u);
+    EXPECT_EQ(strings[5], "more");
+    Vector<std::string, AlignedAllocator<std::string, 128> > copy(strings);
+    EXPECT_TRUE(copy == strings);
+    copy.shrink_to_fit();
+    EXPECT_EQ(copy.size(), 6u);
+
+#if __cplusplus >= 201103L
+    AlignedVector<int, 256> wide(3, 7);
+    EXPECT_EQ(reinterpret_cast<std::size_t>(&*wide.begin()) % 256, 0u);
+    EXPECT_EQ(wide.capacity(), 64u);
+#endif
+
+    AlignedAllocator<int, 32> ints;
+    AlignedAllocator<char, 32> chars(ints);
+    EXPECT_TRUE(chars == ints);
+}
+
+TEST(CowVector, SharesUntilMutation)
+{
+    CowVector<int> config(5, 1);
+    const CowVector<int> snapshot(config);
+    EXPECT_EQ(config.useCount(), 2u);
+    EXPECT_EQ(config.cbegin(), snapshot.begin());
+
+    config.push_back(2);
+    EXPECT_EQ(config.useCount(), 1u);
+    EXPECT_EQ(snapshot.useCount(), 1u);
+    EXPECT_EQ(snapshot.size(), 5u);
+    EXPECT_EQ(config.size(), 6u);
+    EXPECT_EQ(config[5], 2);
+
+    CowVector<int> writer(snapshot);
+    *writer.begin() = 9;
+    EXPECT_EQ(writer[0], 9);
+    EXPECT_EQ(snapshot[0], 1);
+
+    CowVector<int> aliasing(snapshot);
+    aliasing.push_back(aliasing[4]);
+    aliasing.insert(aliasing.cbegin() + 1, aliasing[0]);
+    EXPECT_EQ(aliasing.size(), 7u);
+    aliasing.erase(aliasing.cbegin(), aliasing.cbegin() + 2);
+    EXPECT_EQ(aliasing.size(), 5u);
+    aliasing.resize(8, 3);
+    EXPECT_EQ(aliasing.back(), 3);
+    EXPECT_TRUE(aliasing != snapshot);
+
+    CowVector<int> dropped(snapshot);
+    dropped.clear();
+    EXPECT_TRUE(dropped.empty());
+    EXPECT_EQ(dropped.useCount(), 0u);
+    EXPECT_EQ(snapshot.useCount(), 1u);
+
+    CowVector<std::string> strings;
+    strings.push_back("a");
+    CowVector<std::string> other = strings;
+    other.pop_back();
+    EXPECT_EQ(strings.vector().size(), 1u);
+    EXPECT_TRUE(other.vector() == Vector<std::string>());
+}
+
+TEST(CowVector, WritablePointersAreNotShared)
+{
+    CowVector<int> a(5, 1);
+    int* p = a.begin();
+    CowVector<int> b(a);
+    *p = 9;
+    EXPECT_EQ(a[0], 9);
+    EXPECT_EQ(b[0], 1);
+    EXPECT_EQ(a.useCount(), 1u);
+    EXPECT_EQ(b.useCount(), 1u);
+
+    CowVector<int> c;
+    c = a;
+    *(a.end() - 1) = 7;
+    EXPECT_EQ(c[4], 1);
+    /// Copies of the copy share as usual.
+    const CowVector<int> d(b);
+    EXPECT_EQ(b.useCount(), 2u);
+    EXPECT_EQ(d[0], 1);
+
+    CowVector<int> e(5, 1);
+    int* inserted = e.insert(e.cbegin(), 0);
+    const CowVector<int> f(e);
+    *inserted = 9;
+    EXPECT_EQ(e[0], 9);
+    EXPECT_EQ(f[0], 0);
+
+    CowVector<int> g(5, 1);
+    int* next = g.erase(g.cbegin());
+    const CowVector<int> h(g);
+    *next = 9;
+    EXPECT_EQ(g[0], 9);
+    EXPECT_EQ(h[0], 1);
+}
+
+struct CowReader
+{
+    const CowVector<long>* source;
+    long sum;
+};
+
+void*
+readCowVector(void* argument)
+{
+    CowReader* reader = static_cast<CowReader*>(argument);
+    for (int round = 0; round < 100; ++round) {
+        const CowVector<long> snapshot(*reader->source);
+        long sum = 0;
+        for (CowVector<long>::const_iterator it = snapshot.begin(); it != snapshot.end(); ++it) {
+            sum += *it;
+        }
+        reader->sum = sum;
+    }
+    return NULL;
+}
+
+TEST(CowVector, ConcurrentReaders)
+{
+    const CowVector<long> published(1000, 3L);
+    CowVector<long> writer(published);
+    pthread_t threads[4];
+    CowReader readers[4];
+    for (int i = 0; i < 4; ++i) {
+        readers[i].source = &published;
+        readers[i].sum = 0;
+        pthread_create(&threads[i], NULL, readCowVector, &readers[i]);
+    }
+    for (int i = 0; i < 100; ++i) {
+        writer.push_back(i);
+    }
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], NULL);
+        EXPECT_EQ(readers[i].sum, 3000);
+    }
+    EXPECT_EQ(published.useCount(), 1u);
+    EXPECT_EQ(writer.size(), 1100u);
+}
+
+TEST(PersistentVector, VersionsShareStructure)
+{
+    PersistentVector<int> empty;
+    std::vector<PersistentVector<int> > versions(1, empty);
+    std::vector<int> model;
+    for (int i = 0; i < 5000; ++i) {
+        versions.push_back(versions.back().push_back(i));
+        model.push_back(i);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        const std::size_t index = (i * 7919) % model.size();
+        versions.push_back(versions.back().set(index, -i));
+        model[index] = -i;
+    }
+    const PersistentVector<int>& latest = versions.back();
+    ASSERT_EQ(latest.size(), model.size());
+    EXPECT_TRUE(std::equal(model.begin(), model.end(), latest.begin()));
+    EXPECT_EQ(versions[1].size(), 1u);
+    EXPECT_EQ(versions[1000][999], 999);
+    EXPECT_EQ(versions[5000][4999], 4999);
+    EXPECT_EQ(versions[5000][0], 0);
+    EXPECT_TRUE(versions[3000] == versions[3000].push_back(1).pop_back());
+    EXPECT_TRUE(versions[3000] != versions[3001]);
+
+    PersistentVector<int>::const_iterator it = latest.end();
+    --it;
+    EXPECT_EQ(*it, model.back());
+    EXPECT_EQ(latest.end() - latest.begin(), 5000);
+    EXPECT_EQ(latest.begin()[1234], model[1234]);
+}
+
+TEST(PersistentVector, SlicesAndConversions)
+{
+    Vector<std::string> source;
+    for (int i = 0; i < 2000; ++i) {
+        std::ostringstream text;
+        text << i;
+        source.push_back(text.str());
+    }
+    const PersistentVector<std::string> all(source);
+    EXPECT_TRUE(all.toVector() == source);
+
+    const std::size_t cuts[] = { 0, 1, 31, 32, 33, 1023, 1024, 1025, 1056, 1999, 2000 };
+    for (std::size_t i = 0; i < sizeof(cuts) / sizeof(cuts[0]); ++i) {
+        const PersistentVector<std::string> head = all.take(cuts[i]);
+        const PersistentVector<std::string> rest = all.drop(cuts[i]);
+        ASSERT_EQ(head.size(), cuts[i]);
+        ASSERT_EQ(rest.size(), 2000 - cuts[i]);
+        if (!head.empty()) {
+            EXPECT_EQ(head.back(), source[cuts[i] - 1]);
+        }
+        if (!rest.empty()) {
+            EXPECT_EQ(rest.front(), source[cuts[i]]);
+            EXPECT_EQ(rest.set(rest.size() / 2, "m")[rest.size() / 2], "m");
+        }
+        const PersistentVector<std::string> grown = head.push_back("x").push_back("y");
+        EXPECT_EQ(grown[cuts[i] + 1], "y");
+        const PersistentVector<std::string> shifted = rest.push_back("z");
+        EXPECT_EQ(shifted.back(), "z");
+    }
+
+    const PersistentVector<std::string> window = all.slice(100, 1900);
+    Vector<std::string> copied;
+    window.appendTo(copied);
+    EXPECT_EQ(copied.size(), 1800u);
+    EXPECT_EQ(copied[0], "100");
+    EXPECT_EQ(copied[1799], "1899");
+    EXPECT_EQ(all.drop(1990).drop(5).front(), "1995");
+
+    std::list<int> numbers(100, 4);
+    const PersistentVector<int> fromList(numbers.begin(), numbers.end());
+    EXPECT_EQ(fromList.size(), 100u);
+    EXPECT_EQ(fromList.take(40).drop(39).front(), 4);
+}
+
+TEST(FlatMap, BatchBuildAndLookups)
+{
+    std::vector<int> keys;
+    for (int i = 0; i < 3000; ++i) {
+        keys.push_back((i * 7919) % 1000);
+    }
+    FlatSet<int> set(keys.begin(), keys.end());
+    EXPECT_EQ(set.size(), 1000u);
+    EXPECT_TRUE(std::adjacent_find(set.begin(), set.end(), std::greater_equal<int>()) == set.end());
+    EXPECT_TRUE(set.insert(1000).second);
+    EXPECT_FALSE(set.insert(5).second);
+    EXPECT_EQ(set.erase(5), 1u);
+    EXPECT_EQ(set.erase(5), 0u);
+    EXPECT_FALSE(set.contains(5));
+    const int more[] = { -3, 5, 2000, -3 };
+    set.insert(more, more + 4);
+    EXPECT_EQ(set.size(), 1003u);
+    EXPECT_EQ(*set.begin(), -3);
+
+    const std::vector<int> sorted(set.begin(), set.end());
+    for (int key = -10; key < 2010; ++key) {
+        EXPECT_EQ(set.lower_bound(key) - set.begin(), std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+        EXPECT_EQ(set.upper_bound(key) - set.begin(), std::upper_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+    }
+
+    FlatSet<int, std::greater<int> > descending(keys.begin(), keys.end());
+    EXPECT_EQ(*descending.begin(), 999);
+    EXPECT_EQ(*descending.lower_bound(500), 500);
+
+    std::vector<std::pair<std::string, int> > entries;
+    entries.push_back(std::make_pair(std::string("b"), 1));
+    entries.push_back(std::make_pair(std::string("a"), 2));
+    entries.push_back(std::make_pair(std::string("b"), 3));
+    FlatMap<std::string, int> map(entries.begin(), entries.end());
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at("b"), 1);
+    map["c"] = 4;
+    ++map["a"];
+    map.find("b")->second = 7;
+    EXPECT_EQ(map.at("a"), 3);
+    EXPECT_EQ(map.at("b"), 7);
+    EXPECT_EQ(map.begin()[2].first, "c");
+    EXPECT_THROW(map.at("d"), std::out_of_range);
+    const FlatMap<std::string, int>& constMap = map;
+    EXPECT_TRUE(constMap.find("d") == constMap.end());
+}
+
+TEST(FlatMap, EytzingerLayoutMatchesSortedSearch)
+{
+    for (int n = 0; n < 70; ++n) {
+        FlatSet<int> set;
+        for (int i = 0; i < n; ++i) {
+            set.insert(3 * i);
+        }
+        const EytzingerLayout<FlatSet<int> > layout(set);
+        EXPECT_EQ(layout.size(), set.size());
+        for (int key = -2; key < 3 * n + 2; ++key) {
+            const int* expected = set.lower_bound(key);
+            const int* found = layout.lower_bound(key);
+            if (expected == set.end()) {
+                EXPECT_TRUE(NULL == found);
+            } else {
+                ASSERT_TRUE(found != NULL);
+                EXPECT_EQ(*found, *expected);
+            }
+            EXPECT_EQ(NULL != layout.find(key), set.contains(key));
+        }
+    }
+
+    FlatMap<long, std::string> map;
+    for (long i = 0; i < 1000; ++i) {
+        std::ostringstream text;
+        text << i;
+        map[i * i] = text.str();
+    }
+    const EytzingerLayout<FlatMap<long, std::string> > index(map);
+    EXPECT_EQ(index.find(961)->second, "31");
+    EXPECT_TRUE(NULL == index.find(962));
+    EXPECT_EQ(index.lower_bound(962)->first, 1024);
+}
+
+TEST(BitVector, PackedStorageAndProxies)
+{
+    Vector<bool> flags;
+    for (int i = 0; i < 200; ++i) {
+        flags.push_back(i % 3 == 0);
+    }
+    EXPECT_EQ(flags.size(), 200u);
+    EXPECT_EQ(flags.storage().size(), 4u);
+    EXPECT_EQ(flags.count(), 67u);
+    EXPECT_TRUE(flags[198]);
+    EXPECT_FALSE(flags[199]);
+
+    flags[1] = true;
+    flags[0] = flags[2];
+    (*(flags.begin() + 5)).flip();
+    EXPECT_FALSE(flags[0]);
+    EXPECT_TRUE(flags[1]);
+    EXPECT_TRUE(flags[5]);
+    EXPECT_EQ(std::count(flags.begin(), flags.end(), true), 68);
+    EXPECT_EQ(flags.end() - flags.begin(), 200);
+
+    flags.resize(300, true);
+    EXPECT_EQ(flags.count(), 168u);
+    flags.resize(130);
+    EXPECT_EQ(flags.storage().size(), 3u);
+    EXPECT_EQ(*(flags.storage().end() - 1), 2ull);
+    flags.pop_back();
+    EXPECT_EQ(*(flags.storage().end() - 1), 0ull);
+    flags.pop_back();
+    EXPECT_EQ(flags.storage().size(), 2u);
+    EXPECT_EQ(flags.count(), 44u);
+
+    Vector<bool> all(70, true);
+    EXPECT_TRUE(all.all());
+    all[69] = false;
+    EXPECT_FALSE(all.all());
+    EXPECT_EQ(Vector<bool>(3, 1), Vector<bool>(3, true));
+}
+
+TEST(BitVector, WordLevelEditsMatchModel)
+{
+    Vector<bool> bits;
+    std::vector<bool> model;
+    unsigned long seed = 12345;
+    for (int step = 0; step < 400; ++step) {
+        seed = seed * 6364136223846793005ul + 1442695040888963407ul;
+        const size_t index = model.empty() ? 0 : (seed >> 20) % (model.size() + 1);
+        const size_t n = (seed >> 40) % 150;
+        const bool value = (seed >> 60) & 1;
+        if ((seed >> 33) % 3 != 0 || model.size() < n) {
+            bits.insert(bits.begin() + index, n, value);
+            model.insert(model.begin() + index, n, value);
+            const bool range[] = { true, false, true, true };
+            bits.insert(bits.begin() + index / 2, range, range + 4);
+            model.insert(model.begin() + index / 2, range, range + 4);
+        } else {
+            const size_t first = std::min(index, model.size() - n);
+            bits.erase(bits.begin() + first, bits.begin() + first + n);
+            model.erase(model.begin() + first, model.begin() + first + n);
+        }
+        ASSERT_EQ(bits.size(), model.size());
+        ASSERT_TRUE(std::equal(model.begin(), model.end(), bits.begin()));
+    }
+    EXPECT_EQ(bits.count(), static_cast<size_t>(std::count(model.begin(), model.end(), true)));
+
+    Vector<bool> visited;
+    size_t found = 0;
+    for (size_t i = visited.find_first(); i != Vector<bool>::npos; i = visited.find_next(i)) {
+        ++found;
+    }
+    EXPECT_EQ(found, 0u);
+    std::vector<size_t> expected;
+    for (size_t i = bits.find_first(); i != Vector<bool>::npos; i = bits.find_next(i)) {
+        EXPECT_TRUE(model[i]);
+        expected.push_back(i);
+    }
+    EXPECT_EQ(expected.size(), bits.count());
+
+    Vector<bool> mask(bits.size());
+    mask.set(3, bits.size() - 3);
+    const Vector<bool> both = bits & mask;
+    const Vector<bool> either = bits | mask;
+    const Vector<bool> differ = bits ^ mask;
+    for (size_t i = 0; i < bits.size(); ++i) {
+        ASSERT_EQ(both[i], model[i] && mask[i]);
+        ASSERT_EQ(either[i], model[i] || mask[i]);
+        ASSERT_EQ(differ[i], model[i] != mask[i]);
+    }
+    EXPECT_EQ((~bits).count(), bits.size() - bits.count());
+    EXPECT_EQ(bits ^ bits, Vector<bool>(bits.size()));
+}
+
+TEST(BitVector, InsertsRangeOfItself)
+{
+    Vector<bool> bits;
+    for (int i = 0; i < 70; ++i) {
+        bits.push_back(0 == i % 3);
+    }
+    std::vector<bool> model(bits.begin(), bits.end());
+    bits.insert(bits.end(), bits.begin(), bits.end());
+    model.insert(model.end(), model.begin(), model.begin() + 70);
+    ASSERT_EQ(bits.size(), model.size());
+    EXPECT_TRUE(std::equal(model.begin(), model.end(), bits.begin()));
+
+    const std::vector<bool> middle(model.begin() + 5, model.begin() + 100);
+    bits.insert(bits.begin() + 3, bits.begin() + 5, bits.begin() + 100);
+    model.insert(model.begin() + 3, middle.begin(), middle.end());
+    ASSERT_EQ(bits.size(), model.size());
+    EXPECT_TRUE(std::equal(model.begin(), model.end(), bits.begin()));
+}
+
 int
 main(int argc, char* argv[])
 {
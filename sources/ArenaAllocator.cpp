@@ -0,0 +1,112 @@
+#include "headers/ArenaAllocator.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+char*
+alignUp(char* ptr, const std::size_t alignment)
+{
+    const std::size_t address = reinterpret_cast<std::size_t>(ptr);
+    return reinterpret_cast<char*>((address + alignment - 1) & ~(alignment - 1));
+}
+
+}
+
+Arena::Arena(const std::size_t blockSize)
+    : blocks_(NULL)
+    , current_(NULL)
+    , limit_(NULL)
+    , blockSize_(blockSize)
+    , bytesAllocated_(0)
+{
+}
+
+Arena::~Arena()
+{
+    while (blocks_ != NULL) {
+        Block* next = blocks_->next;
+        ::free(blocks_);
+        blocks_ = next;
+    }
+}
+
+void*
+Arena::allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    assert(alignment != 0 && 0 == (alignment & (alignment - 1)));
+    char* result = alignUp(current_, alignment);
+    if (NULL == current_ || result + bytes > limit_) {
+        grow(bytes, alignment);
+        result = alignUp(current_, alignment);
+    }
+    current_ = result + bytes;
+    bytesAllocated_ += bytes;
+    return result;
+}
+
+void
+Arena::deallocate(void* ptr, const std::size_t bytes)
+{
+    char* const end = static_cast<char*>(ptr) + bytes;
+    if (end == current_) {
+        current_ = static_cast<char*>(ptr);
+        bytesAllocated_ -= bytes;
+    }
+}
+
+/// Keeps the newest block for the next round of allocations and frees the
+/// rest, so a request-scoped arena reaches a steady state with one block.
+void
+Arena::release()
+{
+    if (NULL == blocks_) {
+        return;
+    }
+    Block* next = blocks_->next;
+    while (next != NULL) {
+        Block* nextNext = next->next;
+        ::free(next);
+        next = nextNext;
+    }
+    blocks_->next = NULL;
+    current_ = reinterpret_cast<char*>(blocks_ + 1);
+    limit_ = reinterpret_cast<char*>(blocks_) + blocks_->size;
+    bytesAllocated_ = 0;
+}
+
+std::size_t
+Arena::bytesAllocated() const
+{
+    return bytesAllocated_;
+}
+
+std::size_t
+Arena::blockCount() const
+{
+    std::size_t count = 0;
+    for (const Block* block = blocks_; block != NULL; block = block->next) {
+        ++count;
+    }
+    return count;
+}
+
+void
+Arena::grow(const std::size_t bytes, const std::size_t alignment)
+{
+    std::size_t size = sizeof(Block) + bytes + alignment;
+    if (size < blockSize_) {
+        size = blockSize_;
+    }
+    Block* block = static_cast<Block*>(::malloc(size));
+    if (NULL == block) {
+        throw std::bad_alloc();
+    }
+    block->next = blocks_;
+    block->size = size;
+    blocks_ = block;
+    current_ = reinterpret_cast<char*>(block + 1);
+    limit_ = reinterpret_cast<char*>(block) + size;
+}
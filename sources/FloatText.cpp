@@ -0,0 +1,830 @@
+#include "headers/FloatText.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+__extension__ typedef unsigned __int128 UInt128;
+typedef unsigned long long UInt64;
+
+const UInt64 MASK63 = (1ULL << 63) - 1;
+
+/// Schubfach's k = floor(log10(2^q * c)) ranges over [K_MIN, K_MAX], the
+/// exponent q of Eisel-Lemire's w * 10^q over [FIVE_MIN, FIVE_MAX].
+const int K_MIN = -324;
+const int K_MAX = 292;
+const int FIVE_MIN = -342;
+const int FIVE_MAX = 308;
+
+/// Digits kept in the 64-bit significand while parsing.
+const int MAX_KEPT = 19;
+/// Digits compared exactly when Eisel-Lemire cannot decide; later ones only
+/// count as a sticky digit.
+const int MAX_DIGITS = 800;
+const long EXPONENT_LIMIT = 100000000;
+
+template <typename Float>
+struct BinaryFormat;
+
+template <>
+struct BinaryFormat<double>
+{
+    typedef UInt64 Bits;
+    static const int MANTISSA_BITS = 52;
+    static const int EXPONENT_MASK = 0x7FF;
+    static const int BIAS = 1023;
+    static const int SIGN_SHIFT = 63;
+    static const int Q_MIN = -1074;
+    static const int ROUND_TO_EVEN_MIN = -4;
+    static const int ROUND_TO_EVEN_MAX = 23;
+    static const int SMALLEST_POWER = -342;
+    static const int LARGEST_POWER = 308;
+    static const int FAST_PATH_POWER = 22;
+
+    static double power10(const int n)
+    {
+        static const double POWERS[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        return POWERS[n];
+    }
+};
+
+template <>
+struct BinaryFormat<float>
+{
+    typedef unsigned int Bits;
+    static const int MANTISSA_BITS = 23;
+    static const int EXPONENT_MASK = 0xFF;
+    static const int BIAS = 127;
+    static const int SIGN_SHIFT = 31;
+    static const int Q_MIN = -149;
+    static const int ROUND_TO_EVEN_MIN = -17;
+    static const int ROUND_TO_EVEN_MAX = 10;
+    static const int SMALLEST_POWER = -64;
+    static const int LARGEST_POWER = 38;
+    static const int FAST_PATH_POWER = 10;
+
+    static float power10(const int n)
+    {
+        static const float POWERS[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+        return POWERS[n];
+    }
+};
+
+/// Unsigned integer in little-endian 32-bit limbs, large enough for the power
+/// tables and for the exact comparisons of MAX_DIGITS digits.
+class BigInteger
+{
+public:
+    static const int LIMBS = 140;
+
+    explicit BigInteger(UInt64 value = 0);
+    void multiply(const unsigned int factor);
+    void multiplyPow5(unsigned int n);
+    void add(const unsigned int value);
+    void divide(const unsigned int divisor);
+    void shiftLeft(const unsigned int bits);
+    void shiftRight(const unsigned int bits);
+    int compare(const BigInteger& rhv) const;
+    unsigned int bitLength() const;
+    UInt128 low128() const;
+
+private:
+    void push(const unsigned int limb);
+    void trim();
+
+    unsigned int limbs_[LIMBS];
+    int size_;
+};
+
+BigInteger::BigInteger(UInt64 value)
+    : size_(0)
+{
+    while (value != 0) {
+        limbs_[size_++] = static_cast<unsigned int>(value);
+        value >>= 32;
+    }
+}
+
+void
+BigInteger::push(const unsigned int limb)
+{
+    assert(size_ < LIMBS);
+    limbs_[size_++] = limb;
+}
+
+void
+BigInteger::trim()
+{
+    while (size_ > 0 && 0 == limbs_[size_ - 1]) {
+        --size_;
+    }
+}
+
+void
+BigInteger::multiply(const unsigned int factor)
+{
+    UInt64 carry = 0;
+    for (int i = 0; i < size_; ++i) {
+        carry += static_cast<UInt64>(limbs_[i]) * factor;
+        limbs_[i] = static_cast<unsigned int>(carry);
+        carry >>= 32;
+    }
+    if (carry != 0) {
+        push(static_cast<unsigned int>(carry));
+    }
+}
+
+void
+BigInteger::multiplyPow5(unsigned int n)
+{
+    static const unsigned int POWERS[] = {
+        1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625
+    };
+    for (; n >= 13; n -= 13) {
+        multiply(1220703125);
+    }
+    if (n != 0) {
+        multiply(POWERS[n]);
+    }
+}
+
+void
+BigInteger::add(const unsigned int value)
+{
+    UInt64 carry = value;
+    for (int i = 0; carry != 0 && i < size_; ++i) {
+        carry += limbs_[i];
+        limbs_[i] = static_cast<unsigned int>(carry);
+        carry >>= 32;
+    }
+    if (carry != 0) {
+        push(static_cast<unsigned int>(carry));
+    }
+}
+
+void
+BigInteger::divide(const unsigned int divisor)
+{
+    UInt64 remainder = 0;
+    for (int i = size_ - 1; i >= 0; --i) {
+        remainder = (remainder << 32) | limbs_[i];
+        limbs_[i] = static_cast<unsigned int>(remainder / divisor);
+        remainder %= divisor;
+    }
+    trim();
+}
+
+void
+BigInteger::shiftLeft(const unsigned int bits)
+{
+    if (0 == size_) {
+        return;
+    }
+    const int words = static_cast<int>(bits / 32);
+    const unsigned int rest = bits % 32;
+    assert(size_ + words < LIMBS);
+    if (0 == rest) {
+        for (int i = size_ - 1; i >= 0; --i) {
+            limbs_[i + words] = limbs_[i];
+        }
+    } else {
+        limbs_[size_ + words] = limbs_[size_ - 1] >> (32 - rest);
+        for (int i = size_ - 1; i > 0; --i) {
+            limbs_[i + words] = (limbs_[i] << rest) | (limbs_[i - 1] >> (32 - rest));
+        }
+        limbs_[words] = limbs_[0] << rest;
+        ++size_;
+    }
+    for (int i = 0; i < words; ++i) {
+        limbs_[i] = 0;
+    }
+    size_ += words;
+    trim();
+}
+
+void
+BigInteger::shiftRight(const unsigned int bits)
+{
+    const int words = static_cast<int>(bits / 32);
+    const unsigned int rest = bits % 32;
+    if (words >= size_) {
+        size_ = 0;
+        return;
+    }
+    for (int i = 0; i + words < size_; ++i) {
+        unsigned int limb = limbs_[i + words] >> rest;
+        if (rest != 0 && i + words + 1 < size_) {
+            limb |= limbs_[i + words + 1] << (32 - rest);
+        }
+        limbs_[i] = limb;
+    }
+    size_ -= words;
+    trim();
+}
+
+int
+BigInteger::compare(const BigInteger& rhv) const
+{
+    if (size_ != rhv.size_) {
+        return size_ < rhv.size_ ? -1 : 1;
+    }
+    for (int i = size_ - 1; i >= 0; --i) {
+        if (limbs_[i] != rhv.limbs_[i]) {
+            return limbs_[i] < rhv.limbs_[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+unsigned int
+BigInteger::bitLength() const
+{
+    return 0 == size_ ? 0 : 32 * static_cast<unsigned int>(size_) - __builtin_clz(limbs_[size_ - 1]);
+}
+
+UInt128
+BigInteger::low128() const
+{
+    UInt128 result = 0;
+    for (int i = (size_ < 4 ? size_ : 4) - 1; i >= 0; --i) {
+        result = (result << 32) | limbs_[i];
+    }
+    return result;
+}
+
+int
+floorLog10Pow2(const int e)
+{
+    return static_cast<int>((e * 661971961083LL) >> 41);
+}
+
+int
+floorLog10ThreeQuartersPow2(const int e)
+{
+    return static_cast<int>((e * 661971961083LL - 274743187321LL) >> 41);
+}
+
+int
+floorLog2Pow10(const int e)
+{
+    return static_cast<int>((e * 913124641741LL) >> 38);
+}
+
+/// Built once from exact big-integer powers of 5, for 10^n = 5^n * 2^n.
+struct PowerTables
+{
+    PowerTables();
+    void setG(const int k, const BigInteger& value);
+    void setFive(const int q, BigInteger value);
+
+    /// Schubfach's g = floor(10^-k * 2^-r) + 1 in [2^125, 2^126), split into
+    /// its upper and lower 63 bits.
+    UInt64 g[2 * (K_MAX - K_MIN + 1)];
+    /// The leading 128 bits of 5^q, high word first; rounded up for q < 0 the
+    /// way Eisel-Lemire's proof of correctness expects.
+    UInt64 five[2 * (FIVE_MAX - FIVE_MIN + 1)];
+};
+
+void
+PowerTables::setG(const int k, const BigInteger& value)
+{
+    const UInt128 bits = value.low128();
+    g[2 * (k - K_MIN)] = static_cast<UInt64>(bits >> 63);
+    g[2 * (k - K_MIN) + 1] = static_cast<UInt64>(bits) & MASK63;
+}
+
+void
+PowerTables::setFive(const int q, BigInteger value)
+{
+    const unsigned int length = value.bitLength();
+    if (length > 128) {
+        value.shiftRight(length - 128);
+    } else {
+        value.shiftLeft(128 - length);
+    }
+    const UInt128 bits = value.low128();
+    five[2 * (q - FIVE_MIN)] = static_cast<UInt64>(bits >> 64);
+    five[2 * (q - FIVE_MIN) + 1] = static_cast<UInt64>(bits);
+}
+
+PowerTables::PowerTables()
+{
+    /// power = 5^n and reciprocal = floor(2^RECIPROCAL_BITS / 5^n).
+    const int RECIPROCAL_BITS = 1792;
+    BigInteger power(1);
+    BigInteger reciprocal(1);
+    reciprocal.shiftLeft(RECIPROCAL_BITS);
+    for (int n = 0; n <= -FIVE_MIN; ++n) {
+        if (n <= FIVE_MAX) {
+            setFive(n, power);
+        }
+        if (n <= -K_MIN) {
+            /// 10^n / 2^r with r = floor(log2(10^n)) - 125.
+            const int shift = n - (floorLog2Pow10(n) - 125);
+            BigInteger g(power);
+            if (shift >= 0) {
+                g.shiftLeft(static_cast<unsigned int>(shift));
+            } else {
+                g.shiftRight(static_cast<unsigned int>(-shift));
+            }
+            g.add(1);
+            setG(-n, g);
+        }
+        if (n > 0 && n <= K_MAX) {
+            /// 2^-r / 10^n with r = floor(log2(10^-n)) - 125.
+            const int shift = RECIPROCAL_BITS + floorLog2Pow10(-n) - 125 + n;
+            BigInteger g(reciprocal);
+            g.shiftRight(static_cast<unsigned int>(shift));
+            g.add(1);
+            setG(n, g);
+        }
+        if (n > 0) {
+            /// floor(2^b / 5^n) + 1, b = z + 127 for n <= 27, 2z + 128 above,
+            /// where 5^n has z bits.
+            const int z = static_cast<int>(power.bitLength());
+            const int b = (n <= 27) ? z + 127 : 2 * z + 128;
+            BigInteger five(reciprocal);
+            five.shiftRight(static_cast<unsigned int>(RECIPROCAL_BITS - b));
+            five.add(1);
+            setFive(-n, five);
+        }
+        power.multiply(5);
+        reciprocal.divide(5);
+    }
+}
+
+const PowerTables&
+powerTables()
+{
+    static const PowerTables tables;
+    return tables;
+}
+
+template <typename Float>
+UInt64
+toBits(const Float value)
+{
+    typename BinaryFormat<Float>::Bits bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+struct Decimal
+{
+    UInt64 significand;
+    int exponent;
+};
+
+/// g * cp / 2^128 rounded to odd, g being 10^-k scaled as in PowerTables.
+UInt64
+roundToOdd(const UInt64 g1, const UInt64 g0, const UInt64 cp)
+{
+    const UInt128 x = static_cast<UInt128>(g0) * cp;
+    const UInt128 y = static_cast<UInt128>(g1) * cp;
+    const UInt64 z = (static_cast<UInt64>(y) >> 1) + static_cast<UInt64>(x >> 64);
+    const UInt64 vbp = static_cast<UInt64>(y >> 64) + (z >> 63);
+    return vbp | (((z & MASK63) + MASK63) >> 63);
+}
+
+/// Schubfach: the shortest decimal in the rounding interval of c * 2^q,
+/// the closest to it among those of that length.
+template <typename Float>
+Decimal
+toDecimal(const int q, const UInt64 c)
+{
+    typedef BinaryFormat<Float> Format;
+    const UInt64 out = c & 1;
+    const UInt64 cb = c << 2;
+    const UInt64 cbr = cb + 2;
+    UInt64 cbl;
+    int k;
+    if (c != (1ULL << Format::MANTISSA_BITS) || Format::Q_MIN == q) {
+        cbl = cb - 2;
+        k = floorLog10Pow2(q);
+    } else {
+        cbl = cb - 1;
+        k = floorLog10ThreeQuartersPow2(q);
+    }
+    const int h = q + floorLog2Pow10(-k) + 2;
+    const UInt64* const g = powerTables().g + 2 * (k - K_MIN);
+    const UInt64 vb = roundToOdd(g[0], g[1], cb << h);
+    const UInt64 vbl = roundToOdd(g[0], g[1], cbl << h);
+    const UInt64 vbr = roundToOdd(g[0], g[1], cbr << h);
+    const UInt64 vbLow = vbl + out;
+    const UInt64 vbHigh = vbr - out;
+    Decimal result;
+    const UInt64 s = vb >> 2;
+    /// One digit fewer, which Java's version only tries from s >= 100 because
+    /// it always writes two digits.
+    if (s >= 10) {
+        const UInt64 sp10 = 10 * (s / 10);
+        const UInt64 tp10 = sp10 + 10;
+        const bool upin = vbLow <= 4 * sp10;
+        const bool wpin = 4 * tp10 <= vbHigh;
+        if (upin != wpin) {
+            result.significand = upin ? sp10 : tp10;
+            result.exponent = k;
+            return result;
+        }
+    }
+    const UInt64 t = s + 1;
+    const bool uin = vbLow <= 4 * s;
+    const bool win = 4 * t <= vbHigh;
+    if (uin != win) {
+        result.significand = uin ? s : t;
+    } else {
+        const UInt64 cmp = vb - 2 * (s + t);
+        result.significand = (cmp < (1ULL << 63) && (cmp != 0 || (s & 1) != 0)) ? t : s;
+    }
+    result.exponent = k;
+    return result;
+}
+
+char*
+copyText(const char* text, char* out)
+{
+    while (*text != '\0') {
+        *out++ = *text++;
+    }
+    return out;
+}
+
+/// Lays d * 10^e, the shortest form of c * 2^q, out like std::to_chars: fixed
+/// notation unless scientific is shorter, which has a signed exponent of at
+/// least two digits. Integers too large for their digits to reach the units
+/// place are written exactly in fixed notation, not padded with zeros.
+char*
+writeDecimal(UInt64 d, int e, const UInt64 c, const int q, char* out)
+{
+    while (0 == d % 10) {
+        d /= 10;
+        ++e;
+    }
+    char digits[48];
+    char* const digitsEnd = digits + 24;
+    char* first = digitsEnd;
+    do {
+        *--first = static_cast<char>('0' + d % 10);
+        d /= 10;
+    } while (d != 0);
+    const int n = static_cast<int>(digitsEnd - first);
+    const int scientific = n + e - 1;
+    const int magnitude = scientific < 0 ? -scientific : scientific;
+    const int scientificSize = n + (n > 1 ? 1 : 0) + 2 + (magnitude >= 100 ? 3 : 2);
+    const int fixedSize = (e >= 0) ? n + e : (scientific >= 0 ? n + 1 : n + 1 - scientific);
+    if (fixedSize <= scientificSize) {
+        if (e > 0) {
+            UInt128 exact = (q >= 0) ? static_cast<UInt128>(c) << q : c >> -q;
+            first = digits + sizeof(digits);
+            do {
+                *--first = static_cast<char>('0' + static_cast<unsigned int>(exact % 10));
+                exact /= 10;
+            } while (exact != 0);
+            return std::copy(first, digits + sizeof(digits), out);
+        }
+        if (0 == e) {
+            return std::copy(first, digitsEnd, out);
+        }
+        if (scientific >= 0) {
+            out = std::copy(first, first + scientific + 1, out);
+            *out++ = '.';
+            return std::copy(first + scientific + 1, digitsEnd, out);
+        }
+        *out++ = '0';
+        *out++ = '.';
+        out = std::fill_n(out, -scientific - 1, '0');
+        return std::copy(first, digitsEnd, out);
+    }
+    *out++ = *first++;
+    if (first != digitsEnd) {
+        *out++ = '.';
+        out = std::copy(first, digitsEnd, out);
+    }
+    *out++ = 'e';
+    *out++ = scientific < 0 ? '-' : '+';
+    if (magnitude >= 100) {
+        *out++ = static_cast<char>('0' + magnitude / 100);
+    }
+    *out++ = static_cast<char>('0' + magnitude / 10 % 10);
+    *out++ = static_cast<char>('0' + magnitude % 10);
+    return out;
+}
+
+template <typename Float>
+char*
+formatFloat(const Float value, char* out)
+{
+    typedef BinaryFormat<Float> Format;
+    const UInt64 bits = toBits(value);
+    const UInt64 t = bits & ((1ULL << Format::MANTISSA_BITS) - 1);
+    const int bq = static_cast<int>(bits >> Format::MANTISSA_BITS) & Format::EXPONENT_MASK;
+    if ((bits >> Format::SIGN_SHIFT) != 0) {
+        *out++ = '-';
+    }
+    if (Format::EXPONENT_MASK == bq) {
+        return copyText(0 == t ? "inf" : "nan", out);
+    }
+    if (0 == bq && 0 == t) {
+        *out++ = '0';
+        return out;
+    }
+    const UInt64 c = (0 == bq) ? t : (1ULL << Format::MANTISSA_BITS) | t;
+    const int q = (0 == bq) ? Format::Q_MIN : Format::Q_MIN - 1 + bq;
+    /// Integers are exact already.
+    if (q < 0 && -q <= Format::MANTISSA_BITS && ((c >> -q) << -q) == c) {
+        return writeDecimal(c >> -q, 0, c, q, out);
+    }
+    const Decimal decimal = toDecimal<Float>(q, c);
+    return writeDecimal(decimal.significand, decimal.exponent, c, q, out);
+}
+
+/// A candidate result of parsing: the biased exponent and mantissa fields.
+struct Binary
+{
+    UInt64 mantissa;
+    int power2;
+};
+
+bool
+operator!=(const Binary& lhv, const Binary& rhv)
+{
+    return lhv.mantissa != rhv.mantissa || lhv.power2 != rhv.power2;
+}
+
+/// Eisel-Lemire: the correctly rounded w * 10^q from a 128-bit product
+/// with the leading bits of 5^q, for 0 < w and q within the power table.
+template <typename Float>
+Binary
+computeFloat(const int q, UInt64 w)
+{
+    typedef BinaryFormat<Float> Format;
+    Binary answer;
+    answer.mantissa = 0;
+    answer.power2 = 0;
+    if (q < Format::SMALLEST_POWER) {
+        return answer;
+    }
+    if (q > Format::LARGEST_POWER) {
+        answer.power2 = Format::EXPONENT_MASK;
+        return answer;
+    }
+    const int lz = __builtin_clzll(w);
+    w <<= lz;
+    const UInt64* const five = powerTables().five + 2 * (q - FIVE_MIN);
+    const UInt128 product = static_cast<UInt128>(w) * five[0];
+    UInt64 high = static_cast<UInt64>(product >> 64);
+    UInt64 low = static_cast<UInt64>(product);
+    const UInt64 precisionMask = ~0ULL >> (Format::MANTISSA_BITS + 3);
+    if ((high & precisionMask) == precisionMask) {
+        const UInt64 second = static_cast<UInt64>((static_cast<UInt128>(w) * five[1]) >> 64);
+        low += second;
+        if (second > low) {
+            ++high;
+        }
+    }
+    const int upperBit = static_cast<int>(high >> 63);
+    const int shift = upperBit + 64 - Format::MANTISSA_BITS - 3;
+    answer.mantissa = high >> shift;
+    answer.power2 = ((217706 * q) >> 16) + 63 + upperBit - lz + Format::BIAS;
+    if (answer.power2 <= 0) {
+        if (1 - answer.power2 >= 64) {
+            answer.mantissa = 0;
+            answer.power2 = 0;
+            return answer;
+        }
+        answer.mantissa >>= 1 - answer.power2;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+        answer.power2 = (answer.mantissa < (1ULL << Format::MANTISSA_BITS)) ? 0 : 1;
+        return answer;
+    }
+    /// An exact halfway case has to round down to even instead of up.
+    if (low <= 1 && q >= Format::ROUND_TO_EVEN_MIN && q <= Format::ROUND_TO_EVEN_MAX &&
+            1 == (answer.mantissa & 3) && (answer.mantissa << shift) == high) {
+        answer.mantissa &= ~1ULL;
+    }
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+    if (answer.mantissa >= (2ULL << Format::MANTISSA_BITS)) {
+        answer.mantissa = 1ULL << Format::MANTISSA_BITS;
+        ++answer.power2;
+    }
+    answer.mantissa &= ~(1ULL << Format::MANTISSA_BITS);
+    if (answer.power2 >= Format::EXPONENT_MASK) {
+        answer.mantissa = 0;
+        answer.power2 = Format::EXPONENT_MASK;
+    }
+    return answer;
+}
+
+/// Decides between candidate and the next value up by comparing the decimal
+/// in [first, last) times 10^exponent with the halfway point between them.
+template <typename Float>
+Binary
+roundExactly(const char* first, const char* last, long exponent, Binary candidate)
+{
+    typedef BinaryFormat<Float> Format;
+    static const unsigned int POWERS[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+    BigInteger digits;
+    unsigned int chunk = 0;
+    int chunkDigits = 0;
+    int count = 0;
+    bool fraction = false;
+    bool sticky = false;
+    for (; first != last; ++first) {
+        if ('.' == *first) {
+            fraction = true;
+            continue;
+        }
+        const unsigned int digit = static_cast<unsigned int>(*first - '0');
+        if (count < MAX_DIGITS && (count != 0 || digit != 0)) {
+            chunk = chunk * 10 + digit;
+            if (9 == ++chunkDigits) {
+                digits.multiply(POWERS[9]);
+                digits.add(chunk);
+                chunk = 0;
+                chunkDigits = 0;
+            }
+            ++count;
+            exponent -= fraction ? 1 : 0;
+        } else if (count < MAX_DIGITS) {
+            exponent -= fraction ? 1 : 0;
+        } else {
+            exponent += fraction ? 0 : 1;
+            sticky = sticky || digit != 0;
+        }
+    }
+    digits.multiply(POWERS[chunkDigits]);
+    digits.add(chunk);
+    if (sticky) {
+        digits.multiply(10);
+        digits.add(1);
+        --exponent;
+    }
+    const UInt64 hidden = 1ULL << Format::MANTISSA_BITS;
+    const UInt64 m = (candidate.mantissa & (hidden - 1)) | (0 == candidate.power2 ? 0 : hidden);
+    const long e2 = (0 == candidate.power2 ? 1 : candidate.power2) - Format::BIAS - Format::MANTISSA_BITS;
+    BigInteger halfway(2 * m + 1);
+    if (exponent >= 0) {
+        digits.multiplyPow5(static_cast<unsigned int>(exponent));
+    } else {
+        halfway.multiplyPow5(static_cast<unsigned int>(-exponent));
+    }
+    const long shift = e2 - 1 - exponent;
+    if (shift >= 0) {
+        halfway.shiftLeft(static_cast<unsigned int>(shift));
+    } else {
+        digits.shiftLeft(static_cast<unsigned int>(-shift));
+    }
+    const int order = digits.compare(halfway);
+    if (order > 0 || (0 == order && (m & 1) != 0)) {
+        candidate.mantissa = (candidate.mantissa & (hidden - 1)) + 1;
+        if (candidate.mantissa == hidden) {
+            candidate.mantissa = 0;
+            ++candidate.power2;
+        }
+    }
+    return candidate;
+}
+
+bool
+isDigit(const char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/// Case-insensitive match of the lower-case word at first.
+bool
+startsWith(const char* first, const char* last, const char* word)
+{
+    for (; *word != '\0'; ++first, ++word) {
+        if (first == last || (*first | 0x20) != *word) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Float>
+const char*
+parseFloat(const char* first, const char* last, Float& value)
+{
+    typedef BinaryFormat<Float> Format;
+    const bool negative = first != last && '-' == *first;
+    if (first != last && ('-' == *first || '+' == *first)) {
+        ++first;
+    }
+    if (startsWith(first, last, "nan")) {
+        value = negative ? -std::numeric_limits<Float>::quiet_NaN() : std::numeric_limits<Float>::quiet_NaN();
+        return first + 3;
+    }
+    if (startsWith(first, last, "inf")) {
+        value = negative ? -std::numeric_limits<Float>::infinity() : std::numeric_limits<Float>::infinity();
+        return first + (startsWith(first, last, "infinity") ? 8 : 3);
+    }
+    const char* const digitsFirst = first;
+    UInt64 w = 0;
+    int kept = 0;
+    long exponent = 0;
+    bool truncated = false;
+    bool fraction = false;
+    for (; first != last; ++first) {
+        if ('.' == *first && !fraction) {
+            fraction = true;
+            continue;
+        }
+        if (!isDigit(*first)) {
+            break;
+        }
+        const unsigned int digit = static_cast<unsigned int>(*first - '0');
+        if (kept < MAX_KEPT) {
+            if (w != 0 || digit != 0) {
+                w = w * 10 + digit;
+                ++kept;
+            }
+            exponent -= fraction ? 1 : 0;
+        } else {
+            exponent += fraction ? 0 : 1;
+            truncated = truncated || digit != 0;
+        }
+    }
+    const char* const digitsLast = first;
+    if (digitsLast - digitsFirst == (fraction ? 1 : 0)) {
+        return NULL;
+    }
+    long explicitExponent = 0;
+    if (first != last && ('e' == *first || 'E' == *first)) {
+        const char* p = first + 1;
+        const bool negativeExponent = p != last && '-' == *p;
+        if (p != last && ('-' == *p || '+' == *p)) {
+            ++p;
+        }
+        if (p != last && isDigit(*p)) {
+            for (; p != last && isDigit(*p); ++p) {
+                if (explicitExponent < EXPONENT_LIMIT) {
+                    explicitExponent = explicitExponent * 10 + (*p - '0');
+                }
+            }
+            explicitExponent = negativeExponent ? -explicitExponent : explicitExponent;
+            first = p;
+        }
+    }
+    exponent += explicitExponent;
+    if (0 == w) {
+        value = negative ? -Float(0) : Float(0);
+        return first;
+    }
+    if (!truncated && w <= (2ULL << Format::MANTISSA_BITS) &&
+            exponent >= -Format::FAST_PATH_POWER && exponent <= Format::FAST_PATH_POWER) {
+        const Float magnitude = static_cast<Float>(w);
+        const int power = static_cast<int>(exponent < 0 ? -exponent : exponent);
+        const Float result = exponent < 0 ? magnitude / Format::power10(power) : magnitude * Format::power10(power);
+        value = negative ? -result : result;
+        return first;
+    }
+    const int q = static_cast<int>(exponent < FIVE_MIN ? FIVE_MIN - 1 : (exponent > FIVE_MAX ? FIVE_MAX + 1 : exponent));
+    Binary binary = computeFloat<Float>(q, w);
+    if (truncated && binary != computeFloat<Float>(q, w + 1)) {
+        binary = roundExactly<Float>(digitsFirst, digitsLast, explicitExponent, binary);
+    }
+    if (Format::EXPONENT_MASK == binary.power2) {
+        return NULL;
+    }
+    const typename Format::Bits bits = static_cast<typename Format::Bits>(
+        binary.mantissa | (static_cast<UInt64>(binary.power2) << Format::MANTISSA_BITS) |
+        (static_cast<UInt64>(negative) << Format::SIGN_SHIFT));
+    ::memcpy(&value, &bits, sizeof(value));
+    return first;
+}
+
+}
+
+char*
+FloatText::format(const double value, char* out)
+{
+    return formatFloat(value, out);
+}
+
+char*
+FloatText::format(const float value, char* out)
+{
+    return formatFloat(value, out);
+}
+
+const char*
+FloatText::parse(const char* first, const char* last, double& value)
+{
+    return parseFloat(first, last, value);
+}
+
+const char*
+FloatText::parse(const char* first, const char* last, float& value)
+{
+    return parseFloat(first, last, value);
+}
@@ -0,0 +1,231 @@
+#include "headers/MappedVector.hpp"
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+void
+fail(const char* what)
+{
+    throw std::runtime_error(std::string("MappedFile: ") + what + ": " + ::strerror(errno));
+}
+
+std::size_t
+roundToPage(const std::size_t bytes)
+{
+    const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return (bytes + page - 1) & ~(page - 1);
+}
+
+}
+
+MappedFile::MappedFile(const char* path, const std::size_t elementSize)
+    : fd_(-1)
+    , base_(NULL)
+    , mappedBytes_(0)
+    , fileBytes_(0)
+{
+    ::memset(&header_, 0, sizeof(header_));
+    header_.magic = MAGIC;
+    header_.version = VERSION;
+    header_.elementSize = static_cast<unsigned int>(elementSize);
+
+    fd_ = ::open(path, O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        fail(path);
+    }
+    struct stat status;
+    if (::fstat(fd_, &status) != 0) {
+        ::close(fd_);
+        fail("fstat");
+    }
+    fileBytes_ = static_cast<std::size_t>(status.st_size);
+    try {
+        if (0 == fileBytes_) {
+            writeHeader();
+        } else {
+            readHeader();
+            if (header_.elementSize != elementSize) {
+                throw std::runtime_error("MappedFile: element size mismatch");
+            }
+        }
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+    ::close(fd_);
+}
+
+std::size_t
+MappedFile::elementSize() const
+{
+    return header_.elementSize;
+}
+
+std::size_t
+MappedFile::storedCount() const
+{
+    return static_cast<std::size_t>(header_.count);
+}
+
+std::size_t
+MappedFile::storedCapacity() const
+{
+    return static_cast<std::size_t>(header_.capacity);
+}
+
+unsigned long long
+MappedFile::storedChecksum() const
+{
+    return header_.checksum;
+}
+
+void*
+MappedFile::map(const std::size_t bytes, std::size_t& mapped)
+{
+    assert(NULL == base_);
+    const std::size_t length = roundToPage(HEADER_SIZE + bytes);
+    ensureLength(length);
+    void* base = ::mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (MAP_FAILED == base) {
+        throw std::bad_alloc();
+    }
+    base_ = static_cast<char*>(base);
+    mappedBytes_ = length;
+    mapped = length - HEADER_SIZE;
+    return base_ + HEADER_SIZE;
+}
+
+void*
+MappedFile::remap(const std::size_t bytes, std::size_t& mapped)
+{
+    if (NULL == base_) {
+        return map(bytes, mapped);
+    }
+    const std::size_t length = roundToPage(HEADER_SIZE + bytes);
+    ensureLength(length);
+#ifdef MREMAP_MAYMOVE
+    void* base = ::mremap(base_, mappedBytes_, length, MREMAP_MAYMOVE);
+    if (MAP_FAILED == base) {
+        throw std::bad_alloc();
+    }
+#else
+    void* base = ::mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (MAP_FAILED == base) {
+        throw std::bad_alloc();
+    }
+    ::munmap(base_, mappedBytes_);
+#endif
+    base_ = static_cast<char*>(base);
+    mappedBytes_ = length;
+    mapped = length - HEADER_SIZE;
+    return base_ + HEADER_SIZE;
+}
+
+void
+MappedFile::unmap()
+{
+    if (base_ != NULL) {
+        ::munmap(base_, mappedBytes_);
+        base_ = NULL;
+        mappedBytes_ = 0;
+    }
+}
+
+void
+MappedFile::sync(const std::size_t count, const std::size_t capacity, const unsigned long long checksum)
+{
+    header_.count = count;
+    header_.capacity = capacity;
+    header_.checksum = checksum;
+    writeHeader();
+    if (base_ != NULL && ::msync(base_, mappedBytes_, MS_SYNC) != 0) {
+        fail("msync");
+    }
+}
+
+/// Word-at-a-time multiplicative hash; cheap enough to run over the whole
+/// payload at every sync().
+unsigned long long
+MappedFile::checksum(const void* data, const std::size_t bytes)
+{
+    const unsigned long long PRIME = 0x100000001b3ULL;
+    unsigned long long hash = 0xcbf29ce484222325ULL ^ bytes;
+    const char* p = static_cast<const char*>(data);
+    std::size_t i = 0;
+    for (; i + sizeof(unsigned long long) <= bytes; i += sizeof(unsigned long long)) {
+        unsigned long long word;
+        ::memcpy(&word, p + i, sizeof(word));
+        hash = (hash ^ word) * PRIME;
+        hash ^= hash >> 29;
+    }
+    for (; i < bytes; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(p[i])) * PRIME;
+    }
+    return hash;
+}
+
+void
+MappedFile::readHeader()
+{
+    if (fileBytes_ < HEADER_SIZE || ::pread(fd_, &header_, sizeof(header_), 0) != static_cast<ssize_t>(sizeof(header_))) {
+        throw std::runtime_error("MappedFile: truncated header");
+    }
+    if (header_.magic != MAGIC) {
+        throw std::runtime_error("MappedFile: bad magic");
+    }
+    if (header_.version != VERSION) {
+        throw std::runtime_error("MappedFile: unsupported version");
+    }
+    /// Divides rather than multiplies so that a huge capacity cannot wrap.
+    if (0 == header_.elementSize || header_.count > header_.capacity || header_.capacity > (fileBytes_ - HEADER_SIZE) / header_.elementSize) {
+        throw std::runtime_error("MappedFile: corrupted header");
+    }
+}
+
+void
+MappedFile::writeHeader()
+{
+    char block[HEADER_SIZE];
+    ::memset(block, 0, sizeof(block));
+    ::memcpy(block, &header_, sizeof(header_));
+    if (base_ != NULL) {
+        ::memcpy(base_, block, sizeof(block));
+        return;
+    }
+    ensureLength(HEADER_SIZE);
+    if (::pwrite(fd_, block, sizeof(block), 0) != static_cast<ssize_t>(sizeof(block))) {
+        fail("pwrite");
+    }
+}
+
+void
+MappedFile::ensureLength(const std::size_t bytes)
+{
+    if (bytes <= fileBytes_) {
+        return;
+    }
+    if (::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+        throw std::bad_alloc();
+    }
+    fileBytes_ = bytes;
+}
+
+MappedFileOwner::MappedFileOwner(const char* path, const std::size_t elementSize)
+    : file_(path, elementSize)
+{
+}
@@ -0,0 +1,88 @@
+#include "headers/MmapAllocator.hpp"
+
+#include <cassert>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+void
+adviseHuge(void* ptr, const std::size_t bytes)
+{
+#ifdef MADV_HUGEPAGE
+    if (bytes >= PageMapping::HUGE_PAGE_SIZE) {
+        ::madvise(ptr, bytes, MADV_HUGEPAGE);
+    }
+#else
+    (void)ptr;
+    (void)bytes;
+#endif
+}
+
+}
+
+std::size_t
+PageMapping::pageSize()
+{
+    static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+std::size_t
+PageMapping::roundUp(const std::size_t bytes)
+{
+    const std::size_t page = pageSize();
+    return (bytes + page - 1) & ~(page - 1);
+}
+
+void*
+PageMapping::map(const std::size_t bytes)
+{
+    assert(bytes == roundUp(bytes));
+    /// Over-map by one huge page and trim both ends so that the kernel can
+    /// back the whole range with huge pages.
+    const std::size_t span = (bytes >= HUGE_PAGE_SIZE) ? bytes + HUGE_PAGE_SIZE : bytes;
+    void* raw = ::mmap(NULL, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == raw) {
+        throw std::bad_alloc();
+    }
+    char* begin = static_cast<char*>(raw);
+    if (span != bytes) {
+        const std::size_t address = reinterpret_cast<std::size_t>(raw);
+        const std::size_t head = ((address + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1)) - address;
+        if (head != 0) {
+            ::munmap(begin, head);
+        }
+        begin += head;
+        ::munmap(begin + bytes, span - head - bytes);
+    }
+    adviseHuge(begin, bytes);
+    return begin;
+}
+
+void
+PageMapping::unmap(void* ptr, const std::size_t bytes)
+{
+    if (ptr != NULL) {
+        ::munmap(ptr, bytes);
+    }
+}
+
+void*
+PageMapping::remap(void* ptr, const std::size_t oldBytes, const std::size_t newBytes)
+{
+#ifdef MREMAP_MAYMOVE
+    void* moved = ::mremap(ptr, oldBytes, newBytes, MREMAP_MAYMOVE);
+    if (MAP_FAILED == moved) {
+        return NULL;
+    }
+    adviseHuge(moved, newBytes);
+    return moved;
+#else
+    (void)ptr;
+    (void)oldBytes;
+    (void)newBytes;
+    return NULL;
+#endif
+}
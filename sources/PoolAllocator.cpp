@@ -0,0 +1,93 @@
+#include "headers/PoolAllocator.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+/// Every chunk and the block header are rounded to this, which is the
+/// strictest alignment malloc guarantees on the supported platforms.
+const std::size_t CHUNK_ALIGNMENT = 2 * sizeof(void*);
+
+std::size_t
+roundUp(const std::size_t size)
+{
+    return (size + CHUNK_ALIGNMENT - 1) & ~(CHUNK_ALIGNMENT - 1);
+}
+
+}
+
+FixedPool::FixedPool(const std::size_t chunkSize, const std::size_t chunksPerBlock)
+    : freeList_(NULL)
+    , blocks_(NULL)
+    , chunkSize_(roundUp(chunkSize < sizeof(Node) ? sizeof(Node) : chunkSize))
+    , chunksPerBlock_(chunksPerBlock)
+{
+    assert(chunksPerBlock_ > 0);
+}
+
+FixedPool::~FixedPool()
+{
+    while (blocks_ != NULL) {
+        Node* next = blocks_->next;
+        ::free(blocks_);
+        blocks_ = next;
+    }
+}
+
+void*
+FixedPool::allocate()
+{
+    if (NULL == freeList_) {
+        grow();
+    }
+    Node* chunk = freeList_;
+    freeList_ = chunk->next;
+    return chunk;
+}
+
+void
+FixedPool::deallocate(void* chunk)
+{
+    if (NULL == chunk) {
+        return;
+    }
+    Node* node = static_cast<Node*>(chunk);
+    node->next = freeList_;
+    freeList_ = node;
+}
+
+std::size_t
+FixedPool::chunkSize() const
+{
+    return chunkSize_;
+}
+
+std::size_t
+FixedPool::freeCount() const
+{
+    std::size_t count = 0;
+    for (const Node* node = freeList_; node != NULL; node = node->next) {
+        ++count;
+    }
+    return count;
+}
+
+void
+FixedPool::grow()
+{
+    const std::size_t header = roundUp(sizeof(Node));
+    char* block = static_cast<char*>(::malloc(header + chunkSize_ * chunksPerBlock_));
+    if (NULL == block) {
+        throw std::bad_alloc();
+    }
+    Node* blockNode = reinterpret_cast<Node*>(block);
+    blockNode->next = blocks_;
+    blocks_ = blockNode;
+
+    char* chunk = block + header;
+    for (std::size_t i = 0; i < chunksPerBlock_; ++i, chunk += chunkSize_) {
+        deallocate(chunk);
+    }
+}
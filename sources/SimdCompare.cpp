@@ -0,0 +1,193 @@
+#include "headers/SimdCompare.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_COMPARE_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+std::size_t
+mismatchBytesScalar(const unsigned char* a, const unsigned char* b, std::size_t i, const std::size_t n)
+{
+    while (i < n && a[i] == b[i]) {
+        ++i;
+    }
+    return i;
+}
+
+template <typename T>
+std::size_t
+mismatchScalar(const T* a, const T* b, std::size_t i, const std::size_t n)
+{
+    while (i < n && a[i] == b[i]) {
+        ++i;
+    }
+    return i;
+}
+
+#ifdef SIMD_COMPARE_X86
+std::size_t
+mismatchBytesSse2(const void* a, const void* b, const std::size_t n)
+{
+    const unsigned char* pa = static_cast<const unsigned char*>(a);
+    const unsigned char* pb = static_cast<const unsigned char*>(b);
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + i));
+        const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + i));
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+        if (mask != 0xFFFFu) {
+            return i + __builtin_ctz(~mask);
+        }
+    }
+    return mismatchBytesScalar(pa, pb, i, n);
+}
+
+__attribute__((target("avx2")))
+std::size_t
+mismatchBytesAvx2(const void* a, const void* b, const std::size_t n)
+{
+    const unsigned char* pa = static_cast<const unsigned char*>(a);
+    const unsigned char* pb = static_cast<const unsigned char*>(b);
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pa + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb + i));
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+        if (mask != 0xFFFFFFFFu) {
+            return i + __builtin_ctz(~mask);
+        }
+    }
+    return mismatchBytesScalar(pa, pb, i, n);
+}
+
+std::size_t
+mismatchFloatsSse2(const float* a, const float* b, const std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))));
+        if (mask != 0xFu) {
+            return i + __builtin_ctz(~mask);
+        }
+    }
+    return mismatchScalar(a, b, i, n);
+}
+
+__attribute__((target("avx2")))
+std::size_t
+mismatchFloatsAvx2(const float* a, const float* b, const std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_EQ_OQ);
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(eq));
+        if (mask != 0xFFu) {
+            return i + __builtin_ctz(~mask);
+        }
+    }
+    return mismatchScalar(a, b, i, n);
+}
+
+std::size_t
+mismatchDoublesSse2(const double* a, const double* b, const std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i))));
+        if (mask != 0x3u) {
+            return i + __builtin_ctz(~mask);
+        }
+    }
+    return mismatchScalar(a, b, i, n);
+}
+
+__attribute__((target("avx2")))
+std::size_t
+mismatchDoublesAvx2(const double* a, const double* b, const std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256d eq = _mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_EQ_OQ);
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_pd(eq));
+        if (mask != 0xFu) {
+            return i + __builtin_ctz(~mask);
+        }
+    }
+    return mismatchScalar(a, b, i, n);
+}
+
+bool
+hasAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+typedef std::size_t (*BytesKernel)(const void*, const void*, const std::size_t);
+typedef std::size_t (*FloatsKernel)(const float*, const float*, const std::size_t);
+typedef std::size_t (*DoublesKernel)(const double*, const double*, const std::size_t);
+
+BytesKernel
+selectBytesKernel()
+{
+#ifdef SIMD_COMPARE_X86
+    return hasAvx2() ? mismatchBytesAvx2 : mismatchBytesSse2;
+#else
+    return NULL;
+#endif
+}
+
+FloatsKernel
+selectFloatsKernel()
+{
+#ifdef SIMD_COMPARE_X86
+    return hasAvx2() ? mismatchFloatsAvx2 : mismatchFloatsSse2;
+#else
+    return NULL;
+#endif
+}
+
+DoublesKernel
+selectDoublesKernel()
+{
+#ifdef SIMD_COMPARE_X86
+    return hasAvx2() ? mismatchDoublesAvx2 : mismatchDoublesSse2;
+#else
+    return NULL;
+#endif
+}
+
+}
+
+std::size_t
+mismatchBytes(const void* a, const void* b, const std::size_t n)
+{
+    static const BytesKernel kernel = selectBytesKernel();
+    if (NULL == kernel) {
+        return mismatchBytesScalar(static_cast<const unsigned char*>(a), static_cast<const unsigned char*>(b), 0, n);
+    }
+    return kernel(a, b, n);
+}
+
+std::size_t
+mismatchFloats(const float* a, const float* b, const std::size_t n)
+{
+    static const FloatsKernel kernel = selectFloatsKernel();
+    if (NULL == kernel) {
+        return mismatchScalar(a, b, 0, n);
+    }
+    return kernel(a, b, n);
+}
+
+std::size_t
+mismatchDoubles(const double* a, const double* b, const std::size_t n)
+{
+    static const DoublesKernel kernel = selectDoublesKernel();
+    if (NULL == kernel) {
+        return mismatchScalar(a, b, 0, n);
+    }
+    return kernel(a, b, n);
+}
@@ -0,0 +1,256 @@
+#include "headers/ThreadPool.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace {
+
+const unsigned long long LOW_MASK = 0xffffffffULL;
+
+__thread bool insideTask = false;
+
+unsigned long long
+pack(const unsigned long long begin, const unsigned long long end)
+{
+    return (begin << 32) | end;
+}
+
+}
+
+ThreadPool::Task::~Task()
+{
+}
+
+ThreadPool::ThreadPool(const std::size_t threads)
+    : size_(0 == threads ? hardwareThreads() : threads)
+    , slots_(new Slot[size_])
+    , workers_(new Worker[size_])
+    , threads_(new pthread_t[size_])
+    , task_(NULL)
+    , generation_(0)
+    , active_(0)
+    , failed_(false)
+    , stop_(false)
+{
+    pthread_mutex_init(&runMutex_, NULL);
+    pthread_mutex_init(&mutex_, NULL);
+    pthread_cond_init(&wake_, NULL);
+    pthread_cond_init(&done_, NULL);
+    for (std::size_t i = 0; i < size_; ++i) {
+        slots_[i].range = 0;
+    }
+    /// Slot 0 belongs to the thread calling run().
+    for (std::size_t i = 1; i < size_; ++i) {
+        workers_[i].pool = this;
+        workers_[i].slot = i;
+        if (pthread_create(&threads_[i], NULL, &ThreadPool::workerMain, &workers_[i]) != 0) {
+            size_ = i;
+            break;
+        }
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    pthread_mutex_lock(&mutex_);
+    stop_ = true;
+    pthread_cond_broadcast(&wake_);
+    pthread_mutex_unlock(&mutex_);
+    for (std::size_t i = 1; i < size_; ++i) {
+        pthread_join(threads_[i], NULL);
+    }
+    pthread_cond_destroy(&done_);
+    pthread_cond_destroy(&wake_);
+    pthread_mutex_destroy(&mutex_);
+    pthread_mutex_destroy(&runMutex_);
+    delete [] threads_;
+    delete [] workers_;
+    delete [] slots_;
+}
+
+std::size_t
+ThreadPool::size() const
+{
+    return size_;
+}
+
+ThreadPool&
+ThreadPool::instance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+std::size_t
+ThreadPool::hardwareThreads()
+{
+    const long online = ::sysconf(_SC_NPROCESSORS_ONLN);
+    return online > 0 ? static_cast<std::size_t>(online) : 1;
+}
+
+void
+ThreadPool::run(Task& task, const std::size_t chunks)
+{
+    if (insideTask || 1 == size_ || chunks <= 1) {
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            task.run(chunk);
+        }
+        return;
+    }
+    assert(chunks <= LOW_MASK);
+    pthread_mutex_lock(&runMutex_);
+    for (std::size_t i = 0; i < size_; ++i) {
+        __atomic_store_n(&slots_[i].range, pack(chunks * i / size_, chunks * (i + 1) / size_), __ATOMIC_RELAXED);
+    }
+    pthread_mutex_lock(&mutex_);
+    task_ = &task;
+    __atomic_store_n(&failed_, false, __ATOMIC_RELAXED);
+    active_ = size_ - 1;
+    ++generation_;
+    pthread_cond_broadcast(&wake_);
+    pthread_mutex_unlock(&mutex_);
+
+    work(task, 0);
+
+    pthread_mutex_lock(&mutex_);
+    while (active_ != 0) {
+        pthread_cond_wait(&done_, &mutex_);
+    }
+    task_ = NULL;
+    const bool failed = failed_;
+#if __cplusplus >= 201103L
+    const std::exception_ptr error = error_;
+    error_ = std::exception_ptr();
+#else
+    char message[sizeof(message_)];
+    ::memcpy(message, message_, sizeof(message));
+#endif
+    pthread_mutex_unlock(&mutex_);
+    pthread_mutex_unlock(&runMutex_);
+    if (failed) {
+#if __cplusplus >= 201103L
+        std::rethrow_exception(error);
+#else
+        throw std::runtime_error(message);
+#endif
+    }
+}
+
+void*
+ThreadPool::workerMain(void* argument)
+{
+    Worker* worker = static_cast<Worker*>(argument);
+    worker->pool->workerLoop(worker->slot);
+    return NULL;
+}
+
+void
+ThreadPool::workerLoop(const std::size_t slot)
+{
+    unsigned long seen = 0;
+    pthread_mutex_lock(&mutex_);
+    for (;;) {
+        while (!stop_ && generation_ == seen) {
+            pthread_cond_wait(&wake_, &mutex_);
+        }
+        if (stop_) {
+            break;
+        }
+        seen = generation_;
+        Task* task = task_;
+        pthread_mutex_unlock(&mutex_);
+        work(*task, slot);
+        pthread_mutex_lock(&mutex_);
+        if (0 == --active_) {
+            pthread_cond_signal(&done_);
+        }
+    }
+    pthread_mutex_unlock(&mutex_);
+}
+
+/// Every chunk is run by the participant that popped or stole it, so
+/// once all participants have left work() the task is complete. After a
+/// failure the chunks left in the shares are dropped.
+void
+ThreadPool::work(Task& task, const std::size_t slot)
+{
+    insideTask = true;
+    std::size_t chunk = 0;
+    while (!__atomic_load_n(&failed_, __ATOMIC_RELAXED) && (pop(slot, chunk) || steal(slot, chunk))) {
+        try {
+            task.run(chunk);
+        } catch (...) {
+            fail();
+        }
+    }
+    insideTask = false;
+}
+
+/// Called from a catch handler; keeps the first exception for run().
+void
+ThreadPool::fail()
+{
+    pthread_mutex_lock(&mutex_);
+    if (!failed_) {
+#if __cplusplus >= 201103L
+        error_ = std::current_exception();
+#else
+        const char* what = "ThreadPool: task failed";
+        try {
+            throw;
+        } catch (const std::exception& e) {
+            what = e.what();
+        } catch (...) {
+        }
+        ::strncpy(message_, what, sizeof(message_) - 1);
+        message_[sizeof(message_) - 1] = '\0';
+#endif
+        __atomic_store_n(&failed_, true, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&mutex_);
+}
+
+bool
+ThreadPool::pop(const std::size_t slot, std::size_t& chunk)
+{
+    unsigned long long range = __atomic_load_n(&slots_[slot].range, __ATOMIC_ACQUIRE);
+    for (;;) {
+        const unsigned long long begin = range >> 32;
+        const unsigned long long end = range & LOW_MASK;
+        if (begin >= end) {
+            return false;
+        }
+        if (__atomic_compare_exchange_n(&slots_[slot].range, &range, pack(begin + 1, end), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            chunk = static_cast<std::size_t>(begin);
+            return true;
+        }
+    }
+}
+
+/// Takes the upper half of the first non-empty share after slot, runs its
+/// first chunk and leaves the rest in slot for pop() and for other thieves.
+bool
+ThreadPool::steal(const std::size_t slot, std::size_t& chunk)
+{
+    for (std::size_t step = 1; step < size_; ++step) {
+        Slot& victim = slots_[(slot + step) % size_];
+        unsigned long long range = __atomic_load_n(&victim.range, __ATOMIC_ACQUIRE);
+        for (;;) {
+            const unsigned long long begin = range >> 32;
+            const unsigned long long end = range & LOW_MASK;
+            if (begin >= end) {
+                break;
+            }
+            const unsigned long long middle = end - (end - begin + 1) / 2;
+            if (__atomic_compare_exchange_n(&victim.range, &range, pack(begin, middle), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                __atomic_store_n(&slots_[slot].range, pack(middle + 1, end), __ATOMIC_RELEASE);
+                chunk = static_cast<std::size_t>(middle);
+                return true;
+            }
+        }
+    }
+    return false;
+}
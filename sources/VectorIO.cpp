@@ -0,0 +1,172 @@
+#include "headers/VectorIO.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace {
+
+const char MAGIC[8] = { 'V', 'E', 'C', 'T', 'O', 'R', 'B', '\0' };
+/// Keeps single transfers below the 2 GiB that Linux moves per call.
+const std::size_t MAX_TRANSFER = 1 << 30;
+
+void
+fail(const char* what)
+{
+    throw std::runtime_error(std::string("VectorIO: ") + what + ": " + ::strerror(errno));
+}
+
+unsigned int
+swap32(const unsigned int value)
+{
+    return __builtin_bswap32(value);
+}
+
+}
+
+BinaryHeader::BinaryHeader()
+    : version(VERSION)
+    , elementSize(0)
+    , endianTag(ENDIAN_TAG)
+    , flags(0)
+    , count(0)
+{
+}
+
+BinaryHeader::BinaryHeader(const std::size_t elementSize, const unsigned long long count, const unsigned int flags)
+    : version(VERSION)
+    , elementSize(static_cast<unsigned int>(elementSize))
+    , endianTag(ENDIAN_TAG)
+    , flags(flags)
+    , count(count)
+{
+}
+
+/// Layout: magic[8], version, elementSize, endianTag, flags, count.
+void
+BinaryHeader::encode(char* bytes) const
+{
+    ::memcpy(bytes, MAGIC, sizeof(MAGIC));
+    ::memcpy(bytes + 8, &version, 4);
+    ::memcpy(bytes + 12, &elementSize, 4);
+    ::memcpy(bytes + 16, &endianTag, 4);
+    ::memcpy(bytes + 20, &flags, 4);
+    ::memcpy(bytes + 24, &count, 8);
+}
+
+void
+BinaryHeader::decode(const char* bytes)
+{
+    if (::memcmp(bytes, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("VectorIO: bad magic");
+    }
+    ::memcpy(&version, bytes + 8, 4);
+    ::memcpy(&elementSize, bytes + 12, 4);
+    ::memcpy(&endianTag, bytes + 16, 4);
+    ::memcpy(&flags, bytes + 20, 4);
+    ::memcpy(&count, bytes + 24, 8);
+    if (swapped()) {
+        version = swap32(version);
+        elementSize = swap32(elementSize);
+        flags = swap32(flags);
+        count = __builtin_bswap64(count);
+    } else if (endianTag != ENDIAN_TAG) {
+        throw std::runtime_error("VectorIO: bad byte order tag");
+    }
+    if (version != VERSION) {
+        throw std::runtime_error("VectorIO: unsupported version");
+    }
+}
+
+bool
+BinaryHeader::swapped() const
+{
+    return endianTag == swap32(ENDIAN_TAG);
+}
+
+void
+BinaryIO::write(std::ostream& out, const void* data, const std::size_t bytes)
+{
+    out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    if (!out) {
+        throw std::runtime_error("VectorIO: stream write failed");
+    }
+}
+
+void
+BinaryIO::read(std::istream& in, void* data, const std::size_t bytes)
+{
+    in.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes));
+    if (static_cast<std::size_t>(in.gcount()) != bytes) {
+        throw std::runtime_error("VectorIO: unexpected end of stream");
+    }
+}
+
+void
+BinaryIO::write(const int fd, const void* header, const std::size_t headerBytes, const void* data, const std::size_t bytes)
+{
+    struct iovec parts[2];
+    parts[0].iov_base = const_cast<void*>(header);
+    parts[0].iov_len = headerBytes;
+    parts[1].iov_base = const_cast<void*>(data);
+    parts[1].iov_len = bytes;
+    struct iovec* part = parts;
+    int count = (0 == bytes) ? 1 : 2;
+    while (count != 0) {
+        const std::size_t first = std::min(part->iov_len, MAX_TRANSFER);
+        const std::size_t length = part->iov_len;
+        part->iov_len = first;
+        const ssize_t written = ::writev(fd, part, (first == length) ? count : 1);
+        part->iov_len = length;
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            fail("writev");
+        }
+        std::size_t done = static_cast<std::size_t>(written);
+        while (count != 0 && done >= part->iov_len) {
+            done -= part->iov_len;
+            ++part;
+            --count;
+        }
+        if (count != 0) {
+            part->iov_base = static_cast<char*>(part->iov_base) + done;
+            part->iov_len -= done;
+        }
+    }
+}
+
+void
+BinaryIO::read(const int fd, void* data, const std::size_t bytes)
+{
+    char* p = static_cast<char*>(data);
+    std::size_t left = bytes;
+    while (left != 0) {
+        const ssize_t got = ::read(fd, p, std::min(left, MAX_TRANSFER));
+        if (got < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            fail("read");
+        }
+        if (0 == got) {
+            throw std::runtime_error("VectorIO: unexpected end of file");
+        }
+        p += got;
+        left -= static_cast<std::size_t>(got);
+    }
+}
+
+void
+BinaryIO::swapBytes(void* data, const std::size_t elementSize, const std::size_t n)
+{
+    unsigned char* p = static_cast<unsigned char*>(data);
+    for (std::size_t i = 0; i < n; ++i, p += elementSize) {
+        std::reverse(p, p + elementSize);
+    }
+}
@@ -0,0 +1,124 @@
+#include "headers/VectorStats.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <ostream>
+
+VectorStatsCounters* VectorStats::head_ = NULL;
+VectorGrowthCallback VectorStats::callback_ = NULL;
+void* VectorStats::context_ = NULL;
+
+namespace {
+
+void
+printName(std::ostream& out, const char* name)
+{
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, NULL, NULL, &status);
+    out << (0 == status ? demangled : name);
+    std::free(demangled);
+}
+
+void
+printHistogram(std::ostream& out, const char* title, const unsigned long* buckets, const std::size_t n,
+               const bool powers)
+{
+    out << "  " << title << ':';
+    for (std::size_t i = 0; i < n; ++i) {
+        if (0 == buckets[i]) {
+            continue;
+        }
+        if (!powers) {
+            out << ' ' << i * 10 << "%=" << buckets[i];
+        } else if (0 == i) {
+            out << " 0=" << buckets[i];
+        } else {
+            out << " <2^" << i << '=' << buckets[i];
+        }
+    }
+    out << '\n';
+}
+
+}
+
+const VectorStatsCounters*
+VectorStats::first()
+{
+    return __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+}
+
+void
+VectorStats::reset()
+{
+    for (VectorStatsCounters* stats = __atomic_load_n(&head_, __ATOMIC_ACQUIRE); stats != NULL; stats = stats->next) {
+        const char* name = stats->name;
+        const std::size_t elementSize = stats->elementSize;
+        VectorStatsCounters* next = stats->next;
+        std::memset(stats, 0, sizeof(*stats));
+        stats->name = name;
+        stats->elementSize = elementSize;
+        stats->next = next;
+    }
+}
+
+void
+VectorStats::report(std::ostream& out)
+{
+    for (const VectorStatsCounters* stats = first(); stats != NULL; stats = stats->next) {
+        printName(out, stats->name);
+        out << " (" << stats->elementSize << " bytes per element)\n"
+            << "  growths " << stats->growths << " (implicit " << stats->implicitGrowths
+            << ", in place " << stats->reallocations << "), shrinks " << stats->shrinks
+            << ", allocations " << stats->allocations
+            << ", resizes " << stats->resizes << '\n'
+            << "  bytes relocated " << stats->bytesRelocated << ", bytes copied " << stats->bytesCopied
+            << ", elements shifted " << stats->elementsShifted << '\n'
+            << "  destroyed " << stats->destroyed << ", bytes wasted " << stats->wastedBytes << '\n';
+        printHistogram(out, "final size", stats->sizeHistogram, VectorStatsCounters::SIZE_BUCKETS, true);
+        printHistogram(out, "size / capacity", stats->fillHistogram, VectorStatsCounters::FILL_BUCKETS, false);
+    }
+}
+
+void
+VectorStats::setGrowthCallback(VectorGrowthCallback callback, void* context)
+{
+    __atomic_store_n(&context_, context, __ATOMIC_RELAXED);
+    __atomic_store_n(&callback_, callback, __ATOMIC_RELEASE);
+}
+
+bool
+VectorStats::enroll(VectorStatsCounters* counters, const char* name, const std::size_t elementSize)
+{
+    counters->name = name;
+    counters->elementSize = elementSize;
+    counters->next = __atomic_load_n(&head_, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&head_, &counters->next, counters, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+    }
+    return true;
+}
+
+void
+VectorStats::notify(const VectorGrowthEvent& event)
+{
+    const VectorGrowthCallback callback = __atomic_load_n(&callback_, __ATOMIC_ACQUIRE);
+    if (callback != NULL) {
+        callback(event, __atomic_load_n(&context_, __ATOMIC_RELAXED));
+    }
+}
+
+void
+VectorStats::add(unsigned long& counter, const unsigned long n)
+{
+    __atomic_fetch_add(&counter, n, __ATOMIC_RELAXED);
+}
+
+std::size_t
+VectorStats::sizeBucket(const std::size_t size)
+{
+    std::size_t bucket = 0;
+    for (std::size_t rest = size; rest != 0; rest >>= 1) {
+        ++bucket;
+    }
+    return bucket;
+}
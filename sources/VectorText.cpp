@@ -0,0 +1,195 @@
+#include "headers/VectorText.hpp"
+#include "headers/FloatText.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace {
+
+const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/// Writes value right-aligned ending at end and returns its first digit.
+char*
+formatUnsigned(unsigned long long value, char* end)
+{
+    while (value >= 100) {
+        const unsigned int pair = static_cast<unsigned int>(value % 100) * 2;
+        value /= 100;
+        *--end = DIGIT_PAIRS[pair + 1];
+        *--end = DIGIT_PAIRS[pair];
+    }
+    if (value >= 10) {
+        const unsigned int pair = static_cast<unsigned int>(value) * 2;
+        *--end = DIGIT_PAIRS[pair + 1];
+        *--end = DIGIT_PAIRS[pair];
+    } else {
+        *--end = static_cast<char>('0' + value);
+    }
+    return end;
+}
+
+}
+
+TextWriter::TextWriter(std::ostream& out)
+    : out_(out)
+    , buffer_(new char[BUFFER_SIZE])
+    , current_(buffer_)
+{
+}
+
+TextWriter::~TextWriter()
+{
+    if (current_ != buffer_) {
+        out_.write(buffer_, current_ - buffer_);
+    }
+    delete [] buffer_;
+}
+
+void
+TextWriter::flush()
+{
+    out_.write(buffer_, current_ - buffer_);
+    current_ = buffer_;
+    out_.flush();
+}
+
+char*
+TextWriter::reserve(const std::size_t n)
+{
+    if (static_cast<std::size_t>(buffer_ + BUFFER_SIZE - current_) < n) {
+        out_.write(buffer_, current_ - buffer_);
+        current_ = buffer_;
+    }
+    return current_;
+}
+
+void
+TextWriter::write(const char c)
+{
+    *reserve(1) = c;
+    ++current_;
+}
+
+void
+TextWriter::write(const char* text, const std::size_t n)
+{
+    if (n > BUFFER_SIZE) {
+        reserve(BUFFER_SIZE);
+        out_.write(text, n);
+        return;
+    }
+    ::memcpy(reserve(n), text, n);
+    current_ += n;
+}
+
+void
+TextWriter::writeInteger(const unsigned long long value)
+{
+    char digits[MAX_NUMBER_SIZE];
+    char* const end = digits + sizeof(digits);
+    const char* first = formatUnsigned(value, end);
+    write(first, end - first);
+}
+
+void
+TextWriter::writeInteger(const long long value)
+{
+    char digits[MAX_NUMBER_SIZE];
+    char* const end = digits + sizeof(digits);
+    /// Negate in unsigned arithmetic so that the minimum value works too.
+    const unsigned long long magnitude = (value < 0) ? 0ULL - static_cast<unsigned long long>(value) : value;
+    char* first = formatUnsigned(magnitude, end);
+    if (value < 0) {
+        *--first = '-';
+    }
+    write(first, end - first);
+}
+
+void
+TextWriter::writeFloat(const double value)
+{
+    current_ = FloatText::format(value, reserve(MAX_NUMBER_SIZE));
+}
+
+void
+TextWriter::writeFloat(const float value)
+{
+    current_ = FloatText::format(value, reserve(MAX_NUMBER_SIZE));
+}
+
+const char*
+TextReader::parseInteger(const char* first, const char* last, unsigned long long& value)
+{
+    if (first != last && '+' == *first) {
+        ++first;
+    }
+    const char* const start = first;
+    unsigned long long result = 0;
+    const unsigned long long limit = std::numeric_limits<unsigned long long>::max();
+    for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+        const unsigned int digit = static_cast<unsigned int>(*first - '0');
+        if (result > (limit - digit) / 10) {
+            return NULL;
+        }
+        result = result * 10 + digit;
+    }
+    if (first == start) {
+        return NULL;
+    }
+    value = result;
+    return first;
+}
+
+const char*
+TextReader::parseInteger(const char* first, const char* last, long long& value)
+{
+    const bool negative = (first != last && '-' == *first);
+    unsigned long long magnitude = 0;
+    const char* end = parseInteger(negative ? first + 1 : first, last, magnitude);
+    if (NULL == end) {
+        return NULL;
+    }
+    const unsigned long long limit = static_cast<unsigned long long>(std::numeric_limits<long long>::max());
+    if (magnitude > limit + (negative ? 1 : 0)) {
+        return NULL;
+    }
+    value = negative ? static_cast<long long>(0ULL - magnitude) : static_cast<long long>(magnitude);
+    return end;
+}
+
+const char*
+TextReader::parseFloat(const char* first, const char* last, double& value)
+{
+    return FloatText::parse(first, last, value);
+}
+
+const char*
+TextReader::parseFloat(const char* first, const char* last, float& value)
+{
+    return FloatText::parse(first, last, value);
+}
+
+bool
+TextReader::isSeparator(const char c)
+{
+    return ' ' == c || '\n' == c || '\t' == c || '\r' == c || ',' == c || ';' == c;
+}
+
+const char*
+TextReader::skipSeparators(const char* first, const char* last)
+{
+    while (first != last && isSeparator(*first)) {
+        ++first;
+    }
+    return first;
+}
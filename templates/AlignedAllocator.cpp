@@ -0,0 +1,133 @@
+#ifndef __ALIGNED_ALLOCATOR_CPP__
+#define __ALIGNED_ALLOCATOR_CPP__
+
+#include "../headers/AlignedAllocator.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+AlignedAllocator<T, Alignment, PadToLine>::AlignedAllocator()
+{}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+AlignedAllocator<T, Alignment, PadToLine>::AlignedAllocator(const AlignedAllocator&)
+{}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+template <typename U>
+AlignedAllocator<T, Alignment, PadToLine>::AlignedAllocator(const AlignedAllocator<U, Alignment, PadToLine>&)
+{}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+AlignedAllocator<T, Alignment, PadToLine>::~AlignedAllocator()
+{}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+typename AlignedAllocator<T, Alignment, PadToLine>::pointer
+AlignedAllocator<T, Alignment, PadToLine>::allocate(const size_type n, const void*)
+{
+    if (n > max_size()) {
+        throw std::bad_alloc();
+    }
+    if (0 == n) {
+        return NULL;
+    }
+    void* p = NULL;
+    if (::posix_memalign(&p, BLOCK_ALIGNMENT, blockBytes(n)) != 0) {
+        throw std::bad_alloc();
+    }
+    return static_cast<pointer>(p);
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+void
+AlignedAllocator<T, Alignment, PadToLine>::deallocate(pointer p, const size_type)
+{
+    ::free(p);
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+typename AlignedAllocator<T, Alignment, PadToLine>::size_type
+AlignedAllocator<T, Alignment, PadToLine>::max_size() const
+{
+    return (std::numeric_limits<size_type>::max() - BLOCK_ALIGNMENT) / sizeof(T);
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+void
+AlignedAllocator<T, Alignment, PadToLine>::construct(pointer p, const_reference value)
+{
+    new (p) T(value);
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+void
+AlignedAllocator<T, Alignment, PadToLine>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+typename AlignedAllocator<T, Alignment, PadToLine>::pointer
+AlignedAllocator<T, Alignment, PadToLine>::address(reference r) const
+{
+    return &r;
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+typename AlignedAllocator<T, Alignment, PadToLine>::const_pointer
+AlignedAllocator<T, Alignment, PadToLine>::address(const_reference r) const
+{
+    return &r;
+}
+
+/// Bytes requested for n elements: rounded up to BLOCK_ALIGNMENT with
+/// PadToLine, exact otherwise.
+template <typename T, std::size_t Alignment, bool PadToLine>
+std::size_t
+AlignedAllocator<T, Alignment, PadToLine>::blockBytes(const size_type n)
+{
+    const std::size_t bytes = n * sizeof(T);
+    return PadToLine ? (bytes + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1) : bytes;
+}
+
+template <typename T, typename U, std::size_t Alignment, bool PadToLine>
+bool
+operator==(const AlignedAllocator<T, Alignment, PadToLine>&, const AlignedAllocator<U, Alignment, PadToLine>&)
+{
+    return true;
+}
+
+template <typename T, typename U, std::size_t Alignment, bool PadToLine>
+bool
+operator!=(const AlignedAllocator<T, Alignment, PadToLine>&, const AlignedAllocator<U, Alignment, PadToLine>&)
+{
+    return false;
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+typename AllocatorTraits<AlignedAllocator<T, Alignment, PadToLine> >::pointer
+AllocatorTraits<AlignedAllocator<T, Alignment, PadToLine> >::allocateAtLeast(Allocator& allocator, const size_type n, size_type& allocated)
+{
+    pointer p = allocator.allocate(n);
+    allocated = Allocator::blockBytes(n) / sizeof(T);
+    return p;
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+typename AllocatorTraits<AlignedAllocator<T, Alignment, PadToLine> >::pointer
+AllocatorTraits<AlignedAllocator<T, Alignment, PadToLine> >::reallocate(Allocator&, pointer, const size_type, const size_type, size_type&)
+{
+    return NULL;
+}
+
+template <typename T, std::size_t Alignment, bool PadToLine>
+bool
+AllocatorTraits<AlignedAllocator<T, Alignment, PadToLine> >::isTransferable(const Allocator&, const_pointer)
+{
+    return true;
+}
+
+#endif /// __ALIGNED_ALLOCATOR_CPP__
@@ -0,0 +1,30 @@
+#ifndef __ALLOCATOR_TRAITS_CPP__
+#define __ALLOCATOR_TRAITS_CPP__
+
+#include "../headers/AllocatorTraits.hpp"
+
+#include <cstddef>
+
+template <typename Alloc>
+typename AllocatorTraits<Alloc>::pointer
+AllocatorTraits<Alloc>::allocateAtLeast(Alloc& allocator, const size_type n, size_type& allocated)
+{
+    allocated = n;
+    return allocator.allocate(n);
+}
+
+template <typename Alloc>
+typename AllocatorTraits<Alloc>::pointer
+AllocatorTraits<Alloc>::reallocate(Alloc&, pointer, const size_type, const size_type, size_type&)
+{
+    return NULL;
+}
+
+template <typename Alloc>
+bool
+AllocatorTraits<Alloc>::isTransferable(const Alloc&, const_pointer)
+{
+    return true;
+}
+
+#endif /// __ALLOCATOR_TRAITS_CPP__
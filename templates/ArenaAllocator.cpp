@@ -0,0 +1,102 @@
+#ifndef __ARENA_ALLOCATOR_CPP__
+#define __ARENA_ALLOCATOR_CPP__
+
+#include "../headers/ArenaAllocator.hpp"
+
+#include <limits>
+#include <new>
+
+template <typename T>
+ArenaAllocator<T>::ArenaAllocator(Arena& arena)
+    : arena_(&arena)
+{}
+
+template <typename T>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator& rhv)
+    : arena_(rhv.arena_)
+{}
+
+template <typename T>
+template <typename U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& rhv)
+    : arena_(rhv.arena())
+{}
+
+template <typename T>
+ArenaAllocator<T>::~ArenaAllocator()
+{}
+
+template <typename T>
+typename ArenaAllocator<T>::pointer
+ArenaAllocator<T>::allocate(const size_type n, const void*)
+{
+    if (n > max_size()) {
+        throw std::bad_alloc();
+    }
+    return static_cast<pointer>(arena_->allocate(n * sizeof(T), __alignof__(T)));
+}
+
+template <typename T>
+void
+ArenaAllocator<T>::deallocate(pointer p, const size_type n)
+{
+    arena_->deallocate(p, n * sizeof(T));
+}
+
+template <typename T>
+typename ArenaAllocator<T>::size_type
+ArenaAllocator<T>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T>
+void
+ArenaAllocator<T>::construct(pointer p, const_reference value)
+{
+    new (p) T(value);
+}
+
+template <typename T>
+void
+ArenaAllocator<T>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T>
+typename ArenaAllocator<T>::pointer
+ArenaAllocator<T>::address(reference r) const
+{
+    return &r;
+}
+
+template <typename T>
+typename ArenaAllocator<T>::const_pointer
+ArenaAllocator<T>::address(const_reference r) const
+{
+    return &r;
+}
+
+template <typename T>
+Arena*
+ArenaAllocator<T>::arena() const
+{
+    return arena_;
+}
+
+template <typename T, typename U>
+bool
+operator==(const ArenaAllocator<T>& lhv, const ArenaAllocator<U>& rhv)
+{
+    return lhv.arena() == rhv.arena();
+}
+
+template <typename T, typename U>
+bool
+operator!=(const ArenaAllocator<T>& lhv, const ArenaAllocator<U>& rhv)
+{
+    return !(lhv == rhv);
+}
+
+#endif /// __ARENA_ALLOCATOR_CPP__
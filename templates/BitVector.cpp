@@ -0,0 +1,962 @@
+#ifndef __BIT_VECTOR_CPP__
+#define __BIT_VECTOR_CPP__
+
+#include "../headers/BitVector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+template <typename Alloc, typename Growth>
+const typename Vector<bool, Alloc, Growth>::size_type Vector<bool, Alloc, Growth>::WORD_BITS;
+
+template <typename Alloc, typename Growth>
+const typename Vector<bool, Alloc, Growth>::size_type Vector<bool, Alloc, Growth>::npos;
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::reference::reference(word_type* word, const word_type mask)
+    : word_(word)
+    , mask_(mask)
+{}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::reference::operator bool() const
+{
+    return (*word_ & mask_) != 0;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::reference&
+Vector<bool, Alloc, Growth>::reference::operator=(const bool value)
+{
+    if (value) {
+        *word_ |= mask_;
+    } else {
+        *word_ &= ~mask_;
+    }
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::reference&
+Vector<bool, Alloc, Growth>::reference::operator=(const reference& rhv)
+{
+    return *this = static_cast<bool>(rhv);
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::reference::operator~() const
+{
+    return (*word_ & mask_) == 0;
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::reference::flip()
+{
+    *word_ ^= mask_;
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::const_iterator::const_iterator()
+    : words_(NULL)
+    , index_(0)
+{}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::const_iterator::const_iterator(word_type* words, const size_type index)
+    : words_(words)
+    , index_(index)
+{}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::const_iterator::operator*() const
+{
+    return (words_[index_ / WORD_BITS] & bitMask(index_)) != 0;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::const_iterator::operator[](const difference_type n) const
+{
+    return *(*this + n);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator&
+Vector<bool, Alloc, Growth>::const_iterator::operator++()
+{
+    ++index_;
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator
+Vector<bool, Alloc, Growth>::const_iterator::operator++(int)
+{
+    const const_iterator previous = *this;
+    ++index_;
+    return previous;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator&
+Vector<bool, Alloc, Growth>::const_iterator::operator--()
+{
+    --index_;
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator
+Vector<bool, Alloc, Growth>::const_iterator::operator--(int)
+{
+    const const_iterator previous = *this;
+    --index_;
+    return previous;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator&
+Vector<bool, Alloc, Growth>::const_iterator::operator+=(const difference_type n)
+{
+    index_ += n;
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator&
+Vector<bool, Alloc, Growth>::const_iterator::operator-=(const difference_type n)
+{
+    index_ -= n;
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator
+Vector<bool, Alloc, Growth>::const_iterator::operator+(const difference_type n) const
+{
+    return const_iterator(words_, index_ + n);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator
+Vector<bool, Alloc, Growth>::const_iterator::operator-(const difference_type n) const
+{
+    return const_iterator(words_, index_ - n);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::difference_type
+Vector<bool, Alloc, Growth>::const_iterator::operator-(const const_iterator& rhv) const
+{
+    return static_cast<difference_type>(index_) - static_cast<difference_type>(rhv.index_);
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::const_iterator::operator==(const const_iterator& rhv) const
+{
+    return index_ == rhv.index_;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::const_iterator::operator!=(const const_iterator& rhv) const
+{
+    return index_ != rhv.index_;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::const_iterator::operator<(const const_iterator& rhv) const
+{
+    return index_ < rhv.index_;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::const_iterator::operator<=(const const_iterator& rhv) const
+{
+    return index_ <= rhv.index_;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::const_iterator::operator>(const const_iterator& rhv) const
+{
+    return index_ > rhv.index_;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::const_iterator::operator>=(const const_iterator& rhv) const
+{
+    return index_ >= rhv.index_;
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::iterator::iterator()
+    : const_iterator()
+{}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::iterator::iterator(word_type* words, const size_type index)
+    : const_iterator(words, index)
+{}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::reference
+Vector<bool, Alloc, Growth>::iterator::operator*() const
+{
+    return Vector::reference(this->words_ + this->index_ / WORD_BITS, bitMask(this->index_));
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::reference
+Vector<bool, Alloc, Growth>::iterator::operator[](const difference_type n) const
+{
+    return *(*this + n);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator&
+Vector<bool, Alloc, Growth>::iterator::operator++()
+{
+    ++this->index_;
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::iterator::operator++(int)
+{
+    const iterator previous = *this;
+    ++this->index_;
+    return previous;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator&
+Vector<bool, Alloc, Growth>::iterator::operator--()
+{
+    --this->index_;
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::iterator::operator--(int)
+{
+    const iterator previous = *this;
+    --this->index_;
+    return previous;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator&
+Vector<bool, Alloc, Growth>::iterator::operator+=(const difference_type n)
+{
+    this->index_ += n;
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator&
+Vector<bool, Alloc, Growth>::iterator::operator-=(const difference_type n)
+{
+    this->index_ -= n;
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::iterator::operator+(const difference_type n) const
+{
+    return iterator(this->words_, this->index_ + n);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::iterator::operator-(const difference_type n) const
+{
+    return iterator(this->words_, this->index_ - n);
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::Vector()
+    : words_()
+    , size_(0)
+{}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::Vector(const Alloc& allocator)
+    : words_(word_allocator_type(allocator))
+    , size_(0)
+{}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::Vector(const size_type n, const bool value, const Alloc& allocator)
+    : words_(word_allocator_type(allocator))
+    , size_(0)
+{
+    resize(n, value);
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::Vector(const int n, const bool value, const Alloc& allocator)
+    : words_(word_allocator_type(allocator))
+    , size_(0)
+{
+    resize(static_cast<size_type>(n), value);
+}
+
+template <typename Alloc, typename Growth>
+template <typename InputIterator>
+Vector<bool, Alloc, Growth>::Vector(InputIterator f, InputIterator l, const Alloc& allocator)
+    : words_(word_allocator_type(allocator))
+    , size_(0)
+{
+    initialize(f, l, IsIntegral<InputIterator>());
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::Vector(const Vector& rhv)
+    : words_(rhv.words_)
+    , size_(rhv.size_)
+{}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>&
+Vector<bool, Alloc, Growth>::operator=(const Vector& rhv)
+{
+    words_ = rhv.words_;
+    size_ = rhv.size_;
+    return *this;
+}
+
+#if __cplusplus >= 201103L
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>::Vector(Vector&& rhv) noexcept(AllocatorTraits<word_allocator_type>::ALWAYS_TRANSFERABLE)
+    : words_(std::move(rhv.words_))
+    , size_(rhv.size_)
+{
+    rhv.size_ = 0;
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>&
+Vector<bool, Alloc, Growth>::operator=(Vector&& rhv) noexcept(AllocatorTraits<word_allocator_type>::ALWAYS_TRANSFERABLE)
+{
+    if (this != &rhv) {
+        words_ = std::move(rhv.words_);
+        size_ = rhv.size_;
+        rhv.size_ = 0;
+    }
+    return *this;
+}
+#endif
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::swap(Vector& rhv) VECTOR_NOEXCEPT_IF(AllocatorTraits<word_allocator_type>::ALWAYS_TRANSFERABLE)
+{
+    words_.swap(rhv.words_);
+    std::swap(size_, rhv.size_);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::allocator_type
+Vector<bool, Alloc, Growth>::get_allocator() const
+{
+    return allocator_type(words_.get_allocator());
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::size_type
+Vector<bool, Alloc, Growth>::size() const
+{
+    return size_;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::empty() const
+{
+    return 0 == size_;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::size_type
+Vector<bool, Alloc, Growth>::max_size() const
+{
+    return words_.max_size();
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::size_type
+Vector<bool, Alloc, Growth>::capacity() const
+{
+    return words_.capacity() * WORD_BITS;
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::reserve(const size_type n)
+{
+    words_.reserve(wordsFor(n));
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::shrink_to_fit()
+{
+    words_.shrink_to_fit();
+}
+
+/// New whole words are filled in one pass; only the partial last word is
+/// masked.
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::resize(const size_type n, const bool value)
+{
+    if (n <= size_) {
+        truncate(n);
+        return;
+    }
+    const size_type old = size_;
+    words_.resize(wordsFor(n), value ? ~static_cast<word_type>(0) : 0);
+    size_ = n;
+    if (value && old % WORD_BITS != 0) {
+        words()[old / WORD_BITS] |= ~lowMask(old);
+    }
+    clearTail();
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::push_back(const bool value)
+{
+    if (size_ % WORD_BITS == 0) {
+        words_.push_back(0);
+    }
+    if (value) {
+        words()[size_ / WORD_BITS] |= bitMask(size_);
+    }
+    ++size_;
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::pop_back()
+{
+    assert(size_ > 0);
+    truncate(size_ - 1);
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::clear()
+{
+    words_.clear();
+    size_ = 0;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::operator[](const size_type index) const
+{
+    assert(index < size_);
+    return (words()[index / WORD_BITS] & bitMask(index)) != 0;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::reference
+Vector<bool, Alloc, Growth>::operator[](const size_type index)
+{
+    assert(index < size_);
+    return reference(words() + index / WORD_BITS, bitMask(index));
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::front() const
+{
+    return (*this)[0];
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::back() const
+{
+    return (*this)[size_ - 1];
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator
+Vector<bool, Alloc, Growth>::begin() const
+{
+    return const_iterator(const_cast<word_type*>(words()), 0);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::begin()
+{
+    return iterator(words(), 0);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::const_iterator
+Vector<bool, Alloc, Growth>::end() const
+{
+    return const_iterator(const_cast<word_type*>(words()), size_);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::end()
+{
+    return iterator(words(), size_);
+}
+
+template <typename Alloc, typename Growth>
+const typename Vector<bool, Alloc, Growth>::storage_type&
+Vector<bool, Alloc, Growth>::storage() const
+{
+    return words_;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::insert(iterator pos, const bool value)
+{
+    assert(pos.index_ <= size_);
+    const size_type index = pos.index_;
+    openGap(index, 1);
+    (*this)[index] = value;
+    return iterator(words(), index);
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::insert(iterator pos, const size_type n, const bool value)
+{
+    assert(pos.index_ <= size_);
+    if (0 == n) {
+        return;
+    }
+    openGap(pos.index_, n);
+    set(pos.index_, pos.index_ + n, value);
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::insert(iterator pos, const int n, const bool value)
+{
+    insert(pos, static_cast<size_type>(n), value);
+}
+
+template <typename Alloc, typename Growth>
+template <typename InputIterator>
+void
+Vector<bool, Alloc, Growth>::insert(iterator pos, InputIterator f, InputIterator l)
+{
+    assert(pos.index_ <= size_);
+    rangeInsert(pos.index_, f, l, IsIntegral<InputIterator>());
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::erase(iterator pos)
+{
+    assert(pos.index_ < size_);
+    closeGap(pos.index_, 1);
+    return iterator(words(), pos.index_);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::iterator
+Vector<bool, Alloc, Growth>::erase(iterator f, iterator l)
+{
+    assert(f.index_ <= l.index_ && l.index_ <= size_);
+    if (f.index_ != l.index_) {
+        closeGap(f.index_, l.index_ - f.index_);
+    }
+    return iterator(words(), f.index_);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::size_type
+Vector<bool, Alloc, Growth>::count() const
+{
+    const word_type* w = words();
+    size_type result = 0;
+    for (size_type i = 0; i < words_.size(); ++i) {
+        result += static_cast<size_type>(__builtin_popcountll(w[i]));
+    }
+    return result;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::any() const
+{
+    const word_type* w = words();
+    for (size_type i = 0; i < words_.size(); ++i) {
+        if (w[i] != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::none() const
+{
+    return !any();
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::all() const
+{
+    const word_type* w = words();
+    const size_type full = size_ / WORD_BITS;
+    for (size_type i = 0; i < full; ++i) {
+        if (w[i] != ~static_cast<word_type>(0)) {
+            return false;
+        }
+    }
+    return size_ % WORD_BITS == 0 || w[full] == lowMask(size_);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::size_type
+Vector<bool, Alloc, Growth>::find_first() const
+{
+    return findFrom(0);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::size_type
+Vector<bool, Alloc, Growth>::find_next(const size_type index) const
+{
+    return index >= size_ ? npos : findFrom(index + 1);
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::set(const size_type first, const size_type last, const bool value)
+{
+    assert(first <= last && last <= size_);
+    if (first == last) {
+        return;
+    }
+    word_type* w = words();
+    const size_type head = first / WORD_BITS;
+    const size_type tail = (last - 1) / WORD_BITS;
+    const word_type headMask = ~lowMask(first);
+    const word_type tailMask = last % WORD_BITS == 0 ? ~static_cast<word_type>(0) : lowMask(last);
+    const word_type fill = value ? ~static_cast<word_type>(0) : 0;
+    if (head == tail) {
+        const word_type mask = headMask & tailMask;
+        w[head] = (w[head] & ~mask) | (fill & mask);
+        return;
+    }
+    w[head] = (w[head] & ~headMask) | (fill & headMask);
+    std::fill(w + head + 1, w + tail, fill);
+    w[tail] = (w[tail] & ~tailMask) | (fill & tailMask);
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::flip()
+{
+    word_type* w = words();
+    for (size_type i = 0; i < words_.size(); ++i) {
+        w[i] = ~w[i];
+    }
+    clearTail();
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>&
+Vector<bool, Alloc, Growth>::operator&=(const Vector& rhv)
+{
+    assert(size_ == rhv.size_);
+    word_type* w = words();
+    const word_type* r = rhv.words();
+    for (size_type i = 0; i < words_.size(); ++i) {
+        w[i] &= r[i];
+    }
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>&
+Vector<bool, Alloc, Growth>::operator|=(const Vector& rhv)
+{
+    assert(size_ == rhv.size_);
+    word_type* w = words();
+    const word_type* r = rhv.words();
+    for (size_type i = 0; i < words_.size(); ++i) {
+        w[i] |= r[i];
+    }
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>&
+Vector<bool, Alloc, Growth>::operator^=(const Vector& rhv)
+{
+    assert(size_ == rhv.size_);
+    word_type* w = words();
+    const word_type* r = rhv.words();
+    for (size_type i = 0; i < words_.size(); ++i) {
+        w[i] ^= r[i];
+    }
+    return *this;
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>
+Vector<bool, Alloc, Growth>::operator~() const
+{
+    Vector result(*this);
+    result.flip();
+    return result;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::operator==(const Vector& rhv) const
+{
+    return size_ == rhv.size_ && words_ == rhv.words_;
+}
+
+template <typename Alloc, typename Growth>
+bool
+Vector<bool, Alloc, Growth>::operator!=(const Vector& rhv) const
+{
+    return !(*this == rhv);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::size_type
+Vector<bool, Alloc, Growth>::wordsFor(const size_type bits)
+{
+    return (bits + WORD_BITS - 1) / WORD_BITS;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::word_type
+Vector<bool, Alloc, Growth>::bitMask(const size_type index)
+{
+    return static_cast<word_type>(1) << (index % WORD_BITS);
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::word_type
+Vector<bool, Alloc, Growth>::lowMask(const size_type position)
+{
+    return bitMask(position) - 1;
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::word_type*
+Vector<bool, Alloc, Growth>::words()
+{
+    return 0 == words_.size() ? NULL : &*words_.begin();
+}
+
+template <typename Alloc, typename Growth>
+const typename Vector<bool, Alloc, Growth>::word_type*
+Vector<bool, Alloc, Growth>::words() const
+{
+    return 0 == words_.size() ? NULL : &*words_.begin();
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::clearTail()
+{
+    if (size_ % WORD_BITS != 0) {
+        words()[words_.size() - 1] &= lowMask(size_);
+    }
+}
+
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::truncate(const size_type n)
+{
+    words_.resize(wordsFor(n));
+    size_ = n;
+    clearTail();
+}
+
+/// Grows by n bits and shifts the bits from index on up by n, a word at a
+/// time from the top down. The bits of [index, index + n) are left
+/// unspecified; those below index are restored.
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::openGap(const size_type index, const size_type n)
+{
+    words_.resize(wordsFor(size_ + n), 0);
+    size_ += n;
+    word_type* w = words();
+    const size_type first = index / WORD_BITS;
+    const size_type wordShift = n / WORD_BITS;
+    const size_type bitShift = n % WORD_BITS;
+    const word_type low = w[first] & lowMask(index);
+    for (size_type d = words_.size(); d-- > first; ) {
+        word_type moved = 0;
+        if (d >= first + wordShift) {
+            const size_type s = d - wordShift;
+            moved = w[s] << bitShift;
+            if (bitShift != 0 && s > first) {
+                moved |= w[s - 1] >> (WORD_BITS - bitShift);
+            }
+        }
+        w[d] = moved;
+    }
+    w[first] = (w[first] & ~lowMask(index)) | low;
+}
+
+/// Shifts the bits past index + n down by n, a word at a time from the
+/// bottom up, and drops the last n bits.
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::closeGap(const size_type index, const size_type n)
+{
+    word_type* w = words();
+    const size_type count = words_.size();
+    const size_type first = index / WORD_BITS;
+    const size_type wordShift = n / WORD_BITS;
+    const size_type bitShift = n % WORD_BITS;
+    const word_type low = w[first] & lowMask(index);
+    for (size_type d = first; d < count; ++d) {
+        const size_type s = d + wordShift;
+        word_type moved = s < count ? w[s] >> bitShift : 0;
+        if (bitShift != 0 && s + 1 < count) {
+            moved |= w[s + 1] << (WORD_BITS - bitShift);
+        }
+        w[d] = moved;
+    }
+    w[first] = (w[first] & ~lowMask(index)) | low;
+    truncate(size_ - n);
+}
+
+/// ORs bits in at index, one source word per step; the zero bits past
+/// bits.size() keep the neighbours past the copied range intact.
+template <typename Alloc, typename Growth>
+void
+Vector<bool, Alloc, Growth>::orBits(const size_type index, const Vector& bits)
+{
+    word_type* w = words();
+    const word_type* source = bits.words();
+    const size_type offset = index % WORD_BITS;
+    size_type d = index / WORD_BITS;
+    for (size_type i = 0; i < bits.words_.size(); ++i, ++d) {
+        w[d] |= source[i] << offset;
+        if (offset != 0 && d + 1 < words_.size()) {
+            w[d + 1] |= source[i] >> (WORD_BITS - offset);
+        }
+    }
+}
+
+template <typename Alloc, typename Growth>
+typename Vector<bool, Alloc, Growth>::size_type
+Vector<bool, Alloc, Growth>::findFrom(const size_type position) const
+{
+    if (position >= size_) {
+        return npos;
+    }
+    const word_type* w = words();
+    size_type i = position / WORD_BITS;
+    word_type word = w[i] & ~lowMask(position);
+    while (0 == word) {
+        if (++i == words_.size()) {
+            return npos;
+        }
+        word = w[i];
+    }
+    return i * WORD_BITS + static_cast<size_type>(__builtin_ctzll(word));
+}
+
+template <typename Alloc, typename Growth>
+template <typename Integer>
+void
+Vector<bool, Alloc, Growth>::initialize(Integer n, Integer value, TrueType)
+{
+    resize(static_cast<size_type>(n), value != 0);
+}
+
+template <typename Alloc, typename Growth>
+template <typename InputIterator>
+void
+Vector<bool, Alloc, Growth>::initialize(InputIterator f, InputIterator l, FalseType)
+{
+    for (; f != l; ++f) {
+        push_back(static_cast<bool>(*f));
+    }
+}
+
+template <typename Alloc, typename Growth>
+template <typename Integer>
+void
+Vector<bool, Alloc, Growth>::rangeInsert(const size_type index, Integer n, Integer value, TrueType)
+{
+    insert(iterator(words(), index), static_cast<size_type>(n), value != 0);
+}
+
+/// The range is packed into words first, so the gap is opened once and
+/// filled a word at a time, and a range within this vector is read before
+/// the words move, appending included.
+template <typename Alloc, typename Growth>
+template <typename InputIterator>
+void
+Vector<bool, Alloc, Growth>::rangeInsert(const size_type index, InputIterator f, InputIterator l, FalseType)
+{
+    const Vector bits(f, l, get_allocator());
+    if (bits.empty()) {
+        return;
+    }
+    openGap(index, bits.size_);
+    set(index, index + bits.size_, false);
+    orBits(index, bits);
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>
+operator&(const Vector<bool, Alloc, Growth>& lhv, const Vector<bool, Alloc, Growth>& rhv)
+{
+    Vector<bool, Alloc, Growth> result(lhv);
+    result &= rhv;
+    return result;
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>
+operator|(const Vector<bool, Alloc, Growth>& lhv, const Vector<bool, Alloc, Growth>& rhv)
+{
+    Vector<bool, Alloc, Growth> result(lhv);
+    result |= rhv;
+    return result;
+}
+
+template <typename Alloc, typename Growth>
+Vector<bool, Alloc, Growth>
+operator^(const Vector<bool, Alloc, Growth>& lhv, const Vector<bool, Alloc, Growth>& rhv)
+{
+    Vector<bool, Alloc, Growth> result(lhv);
+    result ^= rhv;
+    return result;
+}
+
+#endif /// __BIT_VECTOR_CPP__
@@ -0,0 +1,348 @@
+#ifndef __CONCURRENT_VECTOR_CPP__
+#define __CONCURRENT_VECTOR_CPP__
+
+#include "../headers/ConcurrentVector.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <sched.h>
+
+template <typename T, typename Alloc>
+ConcurrentVector<T, Alloc>::const_iterator::const_iterator()
+    : vector_(NULL)
+    , index_(0)
+{}
+
+template <typename T, typename Alloc>
+ConcurrentVector<T, Alloc>::const_iterator::const_iterator(const ConcurrentVector* vector, const size_type index)
+    : vector_(vector)
+    , index_(index)
+{}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::const_reference
+ConcurrentVector<T, Alloc>::const_iterator::operator*() const
+{
+    return (*vector_)[index_];
+}
+
+template <typename T, typename Alloc>
+const T*
+ConcurrentVector<T, Alloc>::const_iterator::operator->() const
+{
+    return &(*vector_)[index_];
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::const_iterator&
+ConcurrentVector<T, Alloc>::const_iterator::operator++()
+{
+    index_ = vector_->skipFailed(index_ + 1);
+    return *this;
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::const_iterator
+ConcurrentVector<T, Alloc>::const_iterator::operator++(int)
+{
+    const_iterator temp = *this;
+    ++*this;
+    return temp;
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::const_iterator&
+ConcurrentVector<T, Alloc>::const_iterator::operator--()
+{
+    do {
+        --index_;
+    } while (index_ != 0 && vector_->failed(index_));
+    return *this;
+}
+
+/// An end() taken before a slot failed may point at that slot, while an
+/// iterator stepping over it lands further on.
+template <typename T, typename Alloc>
+bool
+ConcurrentVector<T, Alloc>::const_iterator::operator==(const const_iterator& rhv) const
+{
+    if (index_ == rhv.index_) {
+        return true;
+    }
+    const size_type first = (index_ < rhv.index_) ? index_ : rhv.index_;
+    const size_type last = (index_ < rhv.index_) ? rhv.index_ : index_;
+    return vector_->skipFailed(first) >= last;
+}
+
+template <typename T, typename Alloc>
+bool
+ConcurrentVector<T, Alloc>::const_iterator::operator!=(const const_iterator& rhv) const
+{
+    return !(*this == rhv);
+}
+
+template <typename T, typename Alloc>
+ConcurrentVector<T, Alloc>::ConcurrentVector(const Alloc& allocator)
+    : claimed_(0)
+    , published_(0)
+    , allocator_(allocator)
+{
+    for (size_type k = 0; k < MAX_SEGMENTS; ++k) {
+        segments_[k] = NULL;
+        ready_[k] = NULL;
+    }
+}
+
+template <typename T, typename Alloc>
+ConcurrentVector<T, Alloc>::~ConcurrentVector()
+{
+    clear();
+    FlagAllocator flagAllocator(allocator_);
+    for (size_type k = 0; k < MAX_SEGMENTS; ++k) {
+        if (segments_[k] != NULL) {
+            allocator_.deallocate(segments_[k], segmentSize(k));
+        }
+        if (ready_[k] != NULL) {
+            flagAllocator.deallocate(ready_[k], segmentSize(k));
+        }
+    }
+}
+
+/// Segment 0 holds indices [0, FIRST_SEGMENT); segment k > 0 starts at
+/// FIRST_SEGMENT << (k - 1), the highest power of two not above its indices.
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::size_type
+ConcurrentVector<T, Alloc>::segmentOf(const size_type index)
+{
+    if (index < FIRST_SEGMENT) {
+        return 0;
+    }
+    const size_type highBit = sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(index);
+    return highBit - FIRST_SEGMENT_BITS + 1;
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::size_type
+ConcurrentVector<T, Alloc>::segmentBase(const size_type segment)
+{
+    return (0 == segment) ? 0 : FIRST_SEGMENT << (segment - 1);
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::size_type
+ConcurrentVector<T, Alloc>::segmentSize(const size_type segment)
+{
+    return (0 == segment) ? FIRST_SEGMENT : FIRST_SEGMENT << (segment - 1);
+}
+
+/// The first caller to find segment k missing marks it busy, allocates the
+/// ready flags and then the storage, and publishes them in that order; the
+/// other callers wait for the storage. When an allocation throws the segment
+/// goes back to missing, so that a later caller tries again.
+template <typename T, typename Alloc>
+T*
+ConcurrentVector<T, Alloc>::segment(const size_type k)
+{
+    T* storage = __atomic_load_n(&segments_[k], __ATOMIC_ACQUIRE);
+    while (NULL == storage || busy() == storage) {
+        if (busy() == storage) {
+            ::sched_yield();
+            storage = __atomic_load_n(&segments_[k], __ATOMIC_ACQUIRE);
+            continue;
+        }
+        if (!__atomic_compare_exchange_n(&segments_[k], &storage, busy(), false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+        FlagAllocator flagAllocator(allocator_);
+        char* flags = NULL;
+        try {
+            flags = flagAllocator.allocate(segmentSize(k));
+            storage = allocator_.allocate(segmentSize(k));
+        } catch (...) {
+            if (flags != NULL) {
+                flagAllocator.deallocate(flags, segmentSize(k));
+            }
+            __atomic_store_n(&segments_[k], static_cast<T*>(NULL), __ATOMIC_RELEASE);
+            throw;
+        }
+        ::memset(flags, 0, segmentSize(k));
+        __atomic_store_n(&ready_[k], flags, __ATOMIC_RELEASE);
+        __atomic_store_n(&segments_[k], storage, __ATOMIC_RELEASE);
+    }
+    return storage;
+}
+
+/// Stands in segments_ for a segment being allocated; never a real address.
+template <typename T, typename Alloc>
+T*
+ConcurrentVector<T, Alloc>::busy()
+{
+    return reinterpret_cast<T*>(static_cast<std::size_t>(1));
+}
+
+template <typename T, typename Alloc>
+char*
+ConcurrentVector<T, Alloc>::readyFlags(const size_type k) const
+{
+    return __atomic_load_n(&ready_[k], __ATOMIC_ACQUIRE);
+}
+
+template <typename T, typename Alloc>
+bool
+ConcurrentVector<T, Alloc>::failed(const size_type index) const
+{
+    const size_type k = segmentOf(index);
+    const char* flags = readyFlags(k);
+    return flags != NULL && FAILED == __atomic_load_n(flags + index - segmentBase(k), __ATOMIC_ACQUIRE);
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::size_type
+ConcurrentVector<T, Alloc>::skipFailed(size_type index) const
+{
+    while (failed(index)) {
+        ++index;
+    }
+    return index;
+}
+
+/// The segment is made to exist before the slot is claimed, so that a
+/// failed allocation leaves no hole behind.
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::size_type
+ConcurrentVector<T, Alloc>::push_back(const_reference element)
+{
+    size_type index = __atomic_load_n(&claimed_, __ATOMIC_RELAXED);
+    size_type k;
+    T* storage;
+    do {
+        k = segmentOf(index);
+        assert(k < MAX_SEGMENTS);
+        storage = segment(k);
+    } while (!__atomic_compare_exchange_n(&claimed_, &index, index + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    char* const flag = readyFlags(k) + index - segmentBase(k);
+    try {
+        new (storage + index - segmentBase(k)) T(element);
+    } catch (...) {
+        __atomic_store_n(flag, static_cast<char>(FAILED), __ATOMIC_SEQ_CST);
+        advancePublished();
+        throw;
+    }
+    __atomic_store_n(flag, static_cast<char>(READY), __ATOMIC_SEQ_CST);
+    advancePublished();
+    return index;
+}
+
+/// Moves published_ over every settled slot that follows it. The writer
+/// of the element at published_ either sees the flags set after it or is
+/// seen by their writers, so no ready element is left behind.
+template <typename T, typename Alloc>
+void
+ConcurrentVector<T, Alloc>::advancePublished()
+{
+    size_type published = __atomic_load_n(&published_, __ATOMIC_SEQ_CST);
+    for (;;) {
+        const size_type k = segmentOf(published);
+        const char* flags = readyFlags(k);
+        if (NULL == flags || PENDING == __atomic_load_n(flags + published - segmentBase(k), __ATOMIC_SEQ_CST)) {
+            return;
+        }
+        if (__atomic_compare_exchange_n(&published_, &published, published + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+            ++published;
+        }
+    }
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::size_type
+ConcurrentVector<T, Alloc>::size() const
+{
+    return __atomic_load_n(&published_, __ATOMIC_ACQUIRE);
+}
+
+template <typename T, typename Alloc>
+bool
+ConcurrentVector<T, Alloc>::empty() const
+{
+    return 0 == size();
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::size_type
+ConcurrentVector<T, Alloc>::capacity() const
+{
+    /// Segments 0..k-1 hold exactly segmentBase(k) elements.
+    size_type k = 0;
+    for (; k < MAX_SEGMENTS; ++k) {
+        const T* storage = __atomic_load_n(&segments_[k], __ATOMIC_ACQUIRE);
+        if (NULL == storage || busy() == storage) {
+            break;
+        }
+    }
+    return segmentBase(k);
+}
+
+template <typename T, typename Alloc>
+void
+ConcurrentVector<T, Alloc>::reserve(const size_type n)
+{
+    if (0 == n) {
+        return;
+    }
+    for (size_type k = 0; k <= segmentOf(n - 1); ++k) {
+        segment(k);
+    }
+}
+
+template <typename T, typename Alloc>
+void
+ConcurrentVector<T, Alloc>::clear()
+{
+    /// Failed slots hold no element.
+    for (size_type k = 0; k < MAX_SEGMENTS && segmentBase(k) < claimed_; ++k) {
+        const size_type end = (claimed_ - segmentBase(k) < segmentSize(k)) ? claimed_ - segmentBase(k) : segmentSize(k);
+        for (size_type i = 0; i < end; ++i) {
+            if (READY == ready_[k][i]) {
+                segments_[k][i].~T();
+            }
+        }
+        ::memset(ready_[k], 0, segmentSize(k));
+    }
+    claimed_ = 0;
+    published_ = 0;
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::reference
+ConcurrentVector<T, Alloc>::operator[](const size_type index)
+{
+    assert(!failed(index));
+    const size_type k = segmentOf(index);
+    return __atomic_load_n(&segments_[k], __ATOMIC_ACQUIRE)[index - segmentBase(k)];
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::const_reference
+ConcurrentVector<T, Alloc>::operator[](const size_type index) const
+{
+    assert(!failed(index));
+    const size_type k = segmentOf(index);
+    return __atomic_load_n(&segments_[k], __ATOMIC_ACQUIRE)[index - segmentBase(k)];
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::const_iterator
+ConcurrentVector<T, Alloc>::begin() const
+{
+    return const_iterator(this, skipFailed(0));
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::const_iterator
+ConcurrentVector<T, Alloc>::end() const
+{
+    return const_iterator(this, size());
+}
+
+#endif /// __CONCURRENT_VECTOR_CPP__
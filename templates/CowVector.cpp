@@ -0,0 +1,379 @@
+#ifndef __COW_VECTOR_CPP__
+#define __COW_VECTOR_CPP__
+
+#include "../headers/CowVector.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::Shared::Shared(const vector_type& source)
+    : references(1)
+    , unshareable(false)
+    , elements(source)
+{}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::Shared::Shared(const size_type n, const_reference value)
+    : references(1)
+    , unshareable(false)
+    , elements(n, value)
+{}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename InputIterator>
+CowVector<T, Alloc, Growth>::Shared::Shared(InputIterator f, InputIterator l)
+    : references(1)
+    , unshareable(false)
+    , elements(f, l)
+{}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::Releaser::Releaser(Shared* shared)
+    : shared_(shared)
+{}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::Releaser::~Releaser()
+{
+    release(shared_);
+}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::CowVector()
+    : shared_(NULL)
+    , begin_(NULL)
+    , end_(NULL)
+{}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::CowVector(const vector_type& elements)
+    : shared_(new Shared(elements))
+    , begin_(NULL)
+    , end_(NULL)
+{
+    refresh();
+}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::CowVector(const size_type n, const_reference value)
+    : shared_(new Shared(n, value))
+    , begin_(NULL)
+    , end_(NULL)
+{
+    refresh();
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename InputIterator>
+CowVector<T, Alloc, Growth>::CowVector(InputIterator f, InputIterator l)
+    : shared_(new Shared(f, l))
+    , begin_(NULL)
+    , end_(NULL)
+{
+    refresh();
+}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::CowVector(const CowVector& rhv)
+    : shared_(rhv.shared_)
+    , begin_(rhv.begin_)
+    , end_(rhv.end_)
+{
+    if (NULL == shared_) {
+        return;
+    }
+    if (shared_->unshareable) {
+        shared_ = new Shared(rhv.shared_->elements);
+        refresh();
+        return;
+    }
+    __atomic_add_fetch(&shared_->references, 1, __ATOMIC_RELAXED);
+}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>::~CowVector()
+{
+    release(shared_);
+}
+
+template <typename T, typename Alloc, typename Growth>
+CowVector<T, Alloc, Growth>&
+CowVector<T, Alloc, Growth>::operator=(const CowVector& rhv)
+{
+    CowVector copy(rhv);
+    swap(copy);
+    return *this;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+CowVector<T, Alloc, Growth>::swap(CowVector& rhv)
+{
+    std::swap(shared_, rhv.shared_);
+    std::swap(begin_, rhv.begin_);
+    std::swap(end_, rhv.end_);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+swap(CowVector<T, Alloc, Growth>& lhv, CowVector<T, Alloc, Growth>& rhv)
+{
+    lhv.swap(rhv);
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::size_type
+CowVector<T, Alloc, Growth>::size() const
+{
+    return end_ - begin_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+bool
+CowVector<T, Alloc, Growth>::empty() const
+{
+    return begin_ == end_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::size_type
+CowVector<T, Alloc, Growth>::capacity() const
+{
+    return (NULL == shared_) ? 0 : shared_->elements.capacity();
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::const_reference
+CowVector<T, Alloc, Growth>::operator[](const size_type index) const
+{
+    assert(index < size());
+    return begin_[index];
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::const_reference
+CowVector<T, Alloc, Growth>::front() const
+{
+    assert(!empty());
+    return *begin_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::const_reference
+CowVector<T, Alloc, Growth>::back() const
+{
+    assert(!empty());
+    return *(end_ - 1);
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::const_iterator
+CowVector<T, Alloc, Growth>::begin() const
+{
+    return begin_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::const_iterator
+CowVector<T, Alloc, Growth>::end() const
+{
+    return end_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::const_iterator
+CowVector<T, Alloc, Growth>::cbegin() const
+{
+    return begin_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::const_iterator
+CowVector<T, Alloc, Growth>::cend() const
+{
+    return end_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::iterator
+CowVector<T, Alloc, Growth>::begin()
+{
+    Releaser previous(detach());
+    shared_->unshareable = true;
+    return begin_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::iterator
+CowVector<T, Alloc, Growth>::end()
+{
+    Releaser previous(detach());
+    shared_->unshareable = true;
+    return end_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+const typename CowVector<T, Alloc, Growth>::vector_type&
+CowVector<T, Alloc, Growth>::vector() const
+{
+    static const vector_type empty;
+    return (NULL == shared_) ? empty : shared_->elements;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::size_type
+CowVector<T, Alloc, Growth>::useCount() const
+{
+    return (NULL == shared_) ? 0 : __atomic_load_n(&shared_->references, __ATOMIC_RELAXED);
+}
+
+template <typename T, typename Alloc, typename Growth>
+bool
+CowVector<T, Alloc, Growth>::operator==(const CowVector& rhv) const
+{
+    return shared_ == rhv.shared_ || vector() == rhv.vector();
+}
+
+template <typename T, typename Alloc, typename Growth>
+bool
+CowVector<T, Alloc, Growth>::operator!=(const CowVector& rhv) const
+{
+    return !(*this == rhv);
+}
+
+/// The buffer that was shared stays referenced until the operation is
+/// done, so arguments that refer into it remain valid.
+template <typename T, typename Alloc, typename Growth>
+void
+CowVector<T, Alloc, Growth>::push_back(const_reference element)
+{
+    Releaser previous(detach());
+    shared_->elements.push_back(element);
+    refresh();
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+CowVector<T, Alloc, Growth>::pop_back()
+{
+    assert(!empty());
+    Releaser previous(detach());
+    shared_->elements.pop_back();
+    refresh();
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::iterator
+CowVector<T, Alloc, Growth>::insert(const_iterator pos, const_reference x)
+{
+    assert(pos >= begin_ && pos <= end_);
+    const size_type index = pos - begin_;
+    Releaser previous(detach());
+    typename vector_type::iterator it = shared_->elements.begin();
+    it += static_cast<int>(index);
+    shared_->elements.insert(it, x);
+    shared_->unshareable = true;
+    refresh();
+    return begin_ + index;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::iterator
+CowVector<T, Alloc, Growth>::erase(const_iterator pos)
+{
+    return erase(pos, pos + 1);
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::iterator
+CowVector<T, Alloc, Growth>::erase(const_iterator f, const_iterator l)
+{
+    assert(f >= begin_ && f <= l && l <= end_);
+    const size_type index = f - begin_;
+    const size_type count = l - f;
+    Releaser previous(detach());
+    typename vector_type::iterator first = shared_->elements.begin();
+    first += static_cast<int>(index);
+    typename vector_type::iterator last = first;
+    last += static_cast<int>(count);
+    shared_->elements.erase(first, last);
+    shared_->unshareable = true;
+    refresh();
+    return begin_ + index;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+CowVector<T, Alloc, Growth>::resize(const size_type n, const_reference init)
+{
+    Releaser previous(detach());
+    shared_->elements.resize(n, init);
+    refresh();
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+CowVector<T, Alloc, Growth>::reserve(const size_type n)
+{
+    Releaser previous(detach());
+    shared_->elements.reserve(n);
+    refresh();
+}
+
+/// A shared buffer is let go instead of being copied and then emptied.
+template <typename T, typename Alloc, typename Growth>
+void
+CowVector<T, Alloc, Growth>::clear()
+{
+    if (shared_ != NULL && 1 == __atomic_load_n(&shared_->references, __ATOMIC_ACQUIRE)) {
+        shared_->elements.clear();
+    } else {
+        release(shared_);
+        shared_ = NULL;
+    }
+    refresh();
+}
+
+/// Makes this handle the only owner of its buffer. Returns the buffer it
+/// shared before, whose reference the caller has to release, or NULL.
+template <typename T, typename Alloc, typename Growth>
+typename CowVector<T, Alloc, Growth>::Shared*
+CowVector<T, Alloc, Growth>::detach()
+{
+    if (NULL == shared_) {
+        shared_ = new Shared(vector_type());
+        return NULL;
+    }
+    if (1 == __atomic_load_n(&shared_->references, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    Shared* previous = shared_;
+    shared_ = new Shared(previous->elements);
+    refresh();
+    return previous;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+CowVector<T, Alloc, Growth>::refresh()
+{
+    if (NULL == shared_ || 0 == shared_->elements.size()) {
+        begin_ = NULL;
+        end_ = NULL;
+        return;
+    }
+    begin_ = &*shared_->elements.begin();
+    end_ = begin_ + shared_->elements.size();
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+CowVector<T, Alloc, Growth>::release(Shared* shared)
+{
+    if (shared != NULL && 0 == __atomic_sub_fetch(&shared->references, 1, __ATOMIC_ACQ_REL)) {
+        delete shared;
+    }
+}
+
+#endif /// __COW_VECTOR_CPP__
@@ -0,0 +1,381 @@
+#ifndef __FLAT_MAP_CPP__
+#define __FLAT_MAP_CPP__
+
+#include "../headers/FlatMap.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+template <typename Value, typename Key, typename KeyOf, typename Compare>
+const Value*
+branchlessLowerBound(const Value* first, std::size_t n, const Key& key, const KeyOf& keyOf, const Compare& less)
+{
+    if (0 == n) {
+        return first;
+    }
+    while (n > 1) {
+        const std::size_t half = n / 2;
+        first = less(keyOf(first[half]), key) ? first + half : first;
+        n -= half;
+    }
+    return first + (less(keyOf(*first), key) ? 1 : 0);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Compare>
+const Value*
+branchlessUpperBound(const Value* first, std::size_t n, const Key& key, const KeyOf& keyOf, const Compare& less)
+{
+    if (0 == n) {
+        return first;
+    }
+    while (n > 1) {
+        const std::size_t half = n / 2;
+        first = less(key, keyOf(first[half])) ? first : first + half;
+        n -= half;
+    }
+    return first + (less(key, keyOf(*first)) ? 0 : 1);
+}
+
+template <typename K>
+const K&
+FlatSetKey<K>::operator()(const K& value) const
+{
+    return value;
+}
+
+template <typename K, typename V>
+const K&
+FlatMapKey<K, V>::operator()(const std::pair<K, V>& value) const
+{
+    return value.first;
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+FlatTable<Value, KeyOf, Compare, Alloc>::ValueLess::ValueLess(const Compare& less)
+    : less(less)
+{}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+bool
+FlatTable<Value, KeyOf, Compare, Alloc>::ValueLess::operator()(const Value& lhv, const Value& rhv) const
+{
+    return less(KeyOf()(lhv), KeyOf()(rhv));
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+FlatTable<Value, KeyOf, Compare, Alloc>::FlatTable(const Compare& less)
+    : values_()
+    , less_(less)
+{}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+template <typename InputIterator>
+FlatTable<Value, KeyOf, Compare, Alloc>::FlatTable(InputIterator f, InputIterator l, const Compare& less)
+    : values_()
+    , less_(less)
+{
+    insert(f, l);
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::size_type
+FlatTable<Value, KeyOf, Compare, Alloc>::size() const
+{
+    return values_.size();
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+bool
+FlatTable<Value, KeyOf, Compare, Alloc>::empty() const
+{
+    return 0 == values_.size();
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+void
+FlatTable<Value, KeyOf, Compare, Alloc>::reserve(const size_type n)
+{
+    values_.reserve(n);
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+void
+FlatTable<Value, KeyOf, Compare, Alloc>::clear()
+{
+    values_.clear();
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::const_iterator
+FlatTable<Value, KeyOf, Compare, Alloc>::begin() const
+{
+    return empty() ? NULL : &*values_.begin();
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::const_iterator
+FlatTable<Value, KeyOf, Compare, Alloc>::end() const
+{
+    return begin() + size();
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+const typename FlatTable<Value, KeyOf, Compare, Alloc>::storage_type&
+FlatTable<Value, KeyOf, Compare, Alloc>::storage() const
+{
+    return values_;
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::key_compare
+FlatTable<Value, KeyOf, Compare, Alloc>::key_comp() const
+{
+    return less_;
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+std::pair<typename FlatTable<Value, KeyOf, Compare, Alloc>::const_iterator, bool>
+FlatTable<Value, KeyOf, Compare, Alloc>::insert(const value_type& value)
+{
+    const key_type& key = KeyOf()(value);
+    const_iterator position = lower_bound(key);
+    const size_type index = position - begin();
+    if (position != end() && equivalent(KeyOf()(*position), key)) {
+        return std::make_pair(position, false);
+    }
+    typename storage_type::iterator it = values_.begin();
+    it += static_cast<int>(index);
+    values_.insert(it, value);
+    return std::make_pair(begin() + index, true);
+}
+
+/// The batch is sorted stably on its own, then merged with the existing
+/// values, so among equal keys the one inserted first comes first and is
+/// the one the deduplication keeps.
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+template <typename InputIterator>
+void
+FlatTable<Value, KeyOf, Compare, Alloc>::insert(InputIterator f, InputIterator l)
+{
+    const size_type old = size();
+    values_.insert(values_.end(), f, l);
+    if (empty()) {
+        return;
+    }
+    const ValueLess less(less_);
+    Value* first = data();
+    Value* middle = first + old;
+    Value* last = first + size();
+    std::stable_sort(middle, last, less);
+    std::inplace_merge(first, middle, last, less);
+    Value* unique = first;
+    for (Value* it = first + 1; it != last; ++it) {
+        if (less(*unique, *it)) {
+            ++unique;
+            if (unique != it) {
+                *unique = *it;
+            }
+        }
+    }
+    typename storage_type::iterator tail = values_.begin();
+    tail += static_cast<int>(unique + 1 - first);
+    values_.erase(tail, values_.end());
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::size_type
+FlatTable<Value, KeyOf, Compare, Alloc>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == end()) {
+        return 0;
+    }
+    typename storage_type::iterator it = values_.begin();
+    it += static_cast<int>(position - begin());
+    values_.erase(it);
+    return 1;
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::const_iterator
+FlatTable<Value, KeyOf, Compare, Alloc>::find(const key_type& key) const
+{
+    const_iterator position = lower_bound(key);
+    return (position != end() && equivalent(KeyOf()(*position), key)) ? position : end();
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::size_type
+FlatTable<Value, KeyOf, Compare, Alloc>::count(const key_type& key) const
+{
+    return find(key) == end() ? 0 : 1;
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+bool
+FlatTable<Value, KeyOf, Compare, Alloc>::contains(const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::const_iterator
+FlatTable<Value, KeyOf, Compare, Alloc>::lower_bound(const key_type& key) const
+{
+    return branchlessLowerBound(begin(), size(), key, KeyOf(), less_);
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+typename FlatTable<Value, KeyOf, Compare, Alloc>::const_iterator
+FlatTable<Value, KeyOf, Compare, Alloc>::upper_bound(const key_type& key) const
+{
+    return branchlessUpperBound(begin(), size(), key, KeyOf(), less_);
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+Value*
+FlatTable<Value, KeyOf, Compare, Alloc>::data()
+{
+    return empty() ? NULL : &*values_.begin();
+}
+
+template <typename Value, typename KeyOf, typename Compare, typename Alloc>
+bool
+FlatTable<Value, KeyOf, Compare, Alloc>::equivalent(const key_type& lhv, const key_type& rhv) const
+{
+    return !less_(lhv, rhv) && !less_(rhv, lhv);
+}
+
+template <typename K, typename Compare, typename Alloc>
+FlatSet<K, Compare, Alloc>::FlatSet(const Compare& less)
+    : Base(less)
+{}
+
+template <typename K, typename Compare, typename Alloc>
+template <typename InputIterator>
+FlatSet<K, Compare, Alloc>::FlatSet(InputIterator f, InputIterator l, const Compare& less)
+    : Base(f, l, less)
+{}
+
+template <typename K, typename V, typename Compare, typename Alloc>
+FlatMap<K, V, Compare, Alloc>::FlatMap(const Compare& less)
+    : Base(less)
+{}
+
+template <typename K, typename V, typename Compare, typename Alloc>
+template <typename InputIterator>
+FlatMap<K, V, Compare, Alloc>::FlatMap(InputIterator f, InputIterator l, const Compare& less)
+    : Base(f, l, less)
+{}
+
+template <typename K, typename V, typename Compare, typename Alloc>
+typename FlatMap<K, V, Compare, Alloc>::iterator
+FlatMap<K, V, Compare, Alloc>::find(const key_type& key)
+{
+    const value_type* position = Base::find(key);
+    return Base::data() + (position - Base::begin());
+}
+
+template <typename K, typename V, typename Compare, typename Alloc>
+typename FlatMap<K, V, Compare, Alloc>::mapped_type&
+FlatMap<K, V, Compare, Alloc>::operator[](const key_type& key)
+{
+    iterator position = find(key);
+    if (position == Base::data() + Base::size()) {
+        const value_type* inserted = Base::insert(value_type(key, mapped_type())).first;
+        position = Base::data() + (inserted - Base::begin());
+    }
+    return position->second;
+}
+
+template <typename K, typename V, typename Compare, typename Alloc>
+typename FlatMap<K, V, Compare, Alloc>::mapped_type&
+FlatMap<K, V, Compare, Alloc>::at(const key_type& key)
+{
+    iterator position = find(key);
+    if (position == Base::data() + Base::size()) {
+        throw std::out_of_range("FlatMap::at: key not found");
+    }
+    return position->second;
+}
+
+template <typename K, typename V, typename Compare, typename Alloc>
+const typename FlatMap<K, V, Compare, Alloc>::mapped_type&
+FlatMap<K, V, Compare, Alloc>::at(const key_type& key) const
+{
+    const value_type* position = Base::find(key);
+    if (position == Base::end()) {
+        throw std::out_of_range("FlatMap::at: key not found");
+    }
+    return position->second;
+}
+
+template <typename Table>
+EytzingerLayout<Table>::EytzingerLayout(const Table& table)
+    : layout_()
+    , size_(table.size())
+    , less_(table.key_comp())
+{
+    if (0 == size_) {
+        return;
+    }
+    layout_.resize(size_ + 1, *table.begin());
+    fill(table.begin(), 0, 1);
+}
+
+/// In-order walk of the implicit tree, which visits the slots in sorted
+/// order; returns the next sorted index.
+template <typename Table>
+typename EytzingerLayout<Table>::size_type
+EytzingerLayout<Table>::fill(const value_type* sorted, size_type next, const size_type slot)
+{
+    if (slot > size_) {
+        return next;
+    }
+    next = fill(sorted, next, 2 * slot);
+    typename Vector<value_type>::iterator it = layout_.begin();
+    it += static_cast<int>(slot);
+    *it = sorted[next++];
+    return fill(sorted, next, 2 * slot + 1);
+}
+
+template <typename Table>
+typename EytzingerLayout<Table>::size_type
+EytzingerLayout<Table>::size() const
+{
+    return size_;
+}
+
+/// Descends left or right on each comparison without branching; the
+/// trailing ones of the final slot count the right turns taken after the
+/// last left turn, which is where the answer was.
+template <typename Table>
+const typename EytzingerLayout<Table>::value_type*
+EytzingerLayout<Table>::lower_bound(const key_type& key) const
+{
+    if (0 == size_) {
+        return NULL;
+    }
+    const value_type* slots = &*layout_.begin();
+    const key_of keyOf = key_of();
+    size_type slot = 1;
+    while (slot <= size_) {
+        __builtin_prefetch(slots + slot * PREFETCH_STRIDE);
+        slot = 2 * slot + (less_(keyOf(slots[slot]), key) ? 1 : 0);
+    }
+    slot >>= __builtin_ffsl(static_cast<long>(~slot));
+    return (0 == slot) ? NULL : slots + slot;
+}
+
+template <typename Table>
+const typename EytzingerLayout<Table>::value_type*
+EytzingerLayout<Table>::find(const key_type& key) const
+{
+    const value_type* position = lower_bound(key);
+    if (NULL == position || less_(key, key_of()(*position))) {
+        return NULL;
+    }
+    return position;
+}
+
+#endif /// __FLAT_MAP_CPP__
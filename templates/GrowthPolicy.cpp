@@ -0,0 +1,79 @@
+#ifndef __GROWTH_POLICY_CPP__
+#define __GROWTH_POLICY_CPP__
+
+#include "../headers/GrowthPolicy.hpp"
+
+inline std::size_t
+NeverShrink::shrink(const std::size_t capacity, const std::size_t, const std::size_t)
+{
+    return capacity;
+}
+
+inline std::size_t
+DoublingGrowth::grow(const std::size_t capacity, const std::size_t required, const std::size_t)
+{
+    const std::size_t grown = (0 == capacity) ? 1 : 2 * capacity;
+    return grown < required ? required : grown;
+}
+
+inline std::size_t
+OneAndHalfGrowth::grow(const std::size_t capacity, const std::size_t required, const std::size_t)
+{
+    const std::size_t grown = capacity + (capacity >> 1) + (capacity < 2 ? 1 : 0);
+    return grown < required ? required : grown;
+}
+
+template <std::size_t PageSize>
+std::size_t
+PageGrowth<PageSize>::grow(const std::size_t capacity, const std::size_t required, const std::size_t elementSize)
+{
+    const std::size_t grown = OneAndHalfGrowth::grow(capacity, required, elementSize);
+    const std::size_t bytes = grown * elementSize;
+    if (bytes < PageSize) {
+        return grown;
+    }
+    return ((bytes + PageSize - 1) & ~(PageSize - 1)) / elementSize;
+}
+
+inline std::size_t
+SizeClassGrowth::grow(const std::size_t capacity, const std::size_t required, const std::size_t elementSize)
+{
+    const std::size_t grown = OneAndHalfGrowth::grow(capacity, required, elementSize);
+    return sizeClass(grown * elementSize) / elementSize;
+}
+
+inline std::size_t
+SizeClassGrowth::sizeClass(const std::size_t bytes)
+{
+    const std::size_t MIN_CLASS = 16;
+    if (bytes <= MIN_CLASS) {
+        return MIN_CLASS;
+    }
+    const int log2 = static_cast<int>(sizeof(unsigned long) * 8) - 1 - __builtin_clzl(bytes - 1);
+    std::size_t step = static_cast<std::size_t>(1) << (log2 - 2);
+    if (step < MIN_CLASS) {
+        step = MIN_CLASS;
+    }
+    return (bytes + step - 1) & ~(step - 1);
+}
+
+template <typename Base, std::size_t Fraction, std::size_t MinBytes>
+std::size_t
+ShrinkingGrowth<Base, Fraction, MinBytes>::grow(const std::size_t capacity, const std::size_t required, const std::size_t elementSize)
+{
+    return Base::grow(capacity, required, elementSize);
+}
+
+template <typename Base, std::size_t Fraction, std::size_t MinBytes>
+std::size_t
+ShrinkingGrowth<Base, Fraction, MinBytes>::shrink(const std::size_t capacity, const std::size_t size, const std::size_t elementSize)
+{
+    if (capacity * elementSize <= MinBytes || size * Fraction >= capacity) {
+        return capacity;
+    }
+    const std::size_t floor = MinBytes / elementSize;
+    const std::size_t target = 2 * size;
+    return target < floor ? floor : target;
+}
+
+#endif /// __GROWTH_POLICY_CPP__
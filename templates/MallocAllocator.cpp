@@ -0,0 +1,137 @@
+#ifndef __MALLOC_ALLOCATOR_CPP__
+#define __MALLOC_ALLOCATOR_CPP__
+
+#include "../headers/MallocAllocator.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+template <typename T>
+MallocAllocator<T>::MallocAllocator()
+{}
+
+template <typename T>
+MallocAllocator<T>::MallocAllocator(const MallocAllocator&)
+{}
+
+template <typename T>
+template <typename U>
+MallocAllocator<T>::MallocAllocator(const MallocAllocator<U>&)
+{}
+
+template <typename T>
+MallocAllocator<T>::~MallocAllocator()
+{}
+
+template <typename T>
+typename MallocAllocator<T>::pointer
+MallocAllocator<T>::allocate(const size_type n, const void*)
+{
+    if (n > max_size()) {
+        throw std::bad_alloc();
+    }
+    void* p = ::malloc(n * sizeof(T));
+    if (NULL == p && n != 0) {
+        throw std::bad_alloc();
+    }
+    return static_cast<pointer>(p);
+}
+
+template <typename T>
+void
+MallocAllocator<T>::deallocate(pointer p, const size_type)
+{
+    ::free(p);
+}
+
+template <typename T>
+typename MallocAllocator<T>::size_type
+MallocAllocator<T>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T>
+void
+MallocAllocator<T>::construct(pointer p, const_reference value)
+{
+    new (p) T(value);
+}
+
+template <typename T>
+void
+MallocAllocator<T>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T>
+typename MallocAllocator<T>::pointer
+MallocAllocator<T>::address(reference r) const
+{
+    return &r;
+}
+
+template <typename T>
+typename MallocAllocator<T>::const_pointer
+MallocAllocator<T>::address(const_reference r) const
+{
+    return &r;
+}
+
+template <typename T, typename U>
+bool
+operator==(const MallocAllocator<T>&, const MallocAllocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool
+operator!=(const MallocAllocator<T>&, const MallocAllocator<U>&)
+{
+    return false;
+}
+
+template <typename T>
+typename AllocatorTraits<MallocAllocator<T> >::pointer
+AllocatorTraits<MallocAllocator<T> >::allocateAtLeast(MallocAllocator<T>& allocator, const size_type n, size_type& allocated)
+{
+    pointer p = allocator.allocate(n);
+#ifdef __GLIBC__
+    allocated = (NULL == p) ? n : ::malloc_usable_size(p) / sizeof(T);
+#else
+    allocated = n;
+#endif
+    return p;
+}
+
+template <typename T>
+typename AllocatorTraits<MallocAllocator<T> >::pointer
+AllocatorTraits<MallocAllocator<T> >::reallocate(MallocAllocator<T>&, pointer p, const size_type, const size_type n, size_type& allocated)
+{
+    pointer moved = static_cast<pointer>(::realloc(p, n * sizeof(T)));
+    if (NULL == moved) {
+        return NULL;
+    }
+#ifdef __GLIBC__
+    allocated = ::malloc_usable_size(moved) / sizeof(T);
+#else
+    allocated = n;
+#endif
+    return moved;
+}
+
+template <typename T>
+bool
+AllocatorTraits<MallocAllocator<T> >::isTransferable(const MallocAllocator<T>&, const_pointer)
+{
+    return true;
+}
+
+#endif /// __MALLOC_ALLOCATOR_CPP__
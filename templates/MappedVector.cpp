@@ -0,0 +1,173 @@
+#ifndef __MAPPED_VECTOR_CPP__
+#define __MAPPED_VECTOR_CPP__
+
+#include "../headers/MappedVector.hpp"
+
+#include <cassert>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+template <typename T>
+FileMappingAllocator<T>::FileMappingAllocator(MappedFile* file)
+    : file_(file)
+{}
+
+template <typename T>
+FileMappingAllocator<T>::FileMappingAllocator(const FileMappingAllocator& rhv)
+    : file_(rhv.file_)
+{}
+
+template <typename T>
+template <typename U>
+FileMappingAllocator<T>::FileMappingAllocator(const FileMappingAllocator<U>& rhv)
+    : file_(rhv.file())
+{}
+
+template <typename T>
+FileMappingAllocator<T>::~FileMappingAllocator()
+{}
+
+template <typename T>
+typename FileMappingAllocator<T>::pointer
+FileMappingAllocator<T>::allocate(const size_type n, const void*)
+{
+    if (n > max_size()) {
+        throw std::bad_alloc();
+    }
+    std::size_t mapped = 0;
+    return static_cast<pointer>(file_->map(n * sizeof(T), mapped));
+}
+
+template <typename T>
+void
+FileMappingAllocator<T>::deallocate(pointer, const size_type)
+{
+    file_->unmap();
+}
+
+template <typename T>
+typename FileMappingAllocator<T>::size_type
+FileMappingAllocator<T>::max_size() const
+{
+    return (std::numeric_limits<size_type>::max() / 2 - MappedFile::HEADER_SIZE) / sizeof(T);
+}
+
+template <typename T>
+void
+FileMappingAllocator<T>::construct(pointer p, const_reference value)
+{
+    new (p) T(value);
+}
+
+template <typename T>
+void
+FileMappingAllocator<T>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T>
+typename FileMappingAllocator<T>::pointer
+FileMappingAllocator<T>::address(reference r) const
+{
+    return &r;
+}
+
+template <typename T>
+typename FileMappingAllocator<T>::const_pointer
+FileMappingAllocator<T>::address(const_reference r) const
+{
+    return &r;
+}
+
+template <typename T>
+MappedFile*
+FileMappingAllocator<T>::file() const
+{
+    return file_;
+}
+
+template <typename T, typename U>
+bool
+operator==(const FileMappingAllocator<T>& lhv, const FileMappingAllocator<U>& rhv)
+{
+    return lhv.file() == rhv.file();
+}
+
+template <typename T, typename U>
+bool
+operator!=(const FileMappingAllocator<T>& lhv, const FileMappingAllocator<U>& rhv)
+{
+    return !(lhv == rhv);
+}
+
+template <typename T>
+typename AllocatorTraits<FileMappingAllocator<T> >::pointer
+AllocatorTraits<FileMappingAllocator<T> >::allocateAtLeast(FileMappingAllocator<T>& allocator, const size_type n, size_type& allocated)
+{
+    if (n > allocator.max_size()) {
+        throw std::bad_alloc();
+    }
+    std::size_t mapped = 0;
+    pointer p = static_cast<pointer>(allocator.file()->map(n * sizeof(T), mapped));
+    allocated = mapped / sizeof(T);
+    return p;
+}
+
+/// Never returns NULL: the file has no second buffer to fall back to.
+template <typename T>
+typename AllocatorTraits<FileMappingAllocator<T> >::pointer
+AllocatorTraits<FileMappingAllocator<T> >::reallocate(FileMappingAllocator<T>& allocator, pointer, const size_type, const size_type n, size_type& allocated)
+{
+    if (n > allocator.max_size()) {
+        throw std::bad_alloc();
+    }
+    std::size_t mapped = 0;
+    pointer p = static_cast<pointer>(allocator.file()->remap(n * sizeof(T), mapped));
+    allocated = mapped / sizeof(T);
+    return p;
+}
+
+template <typename T>
+bool
+AllocatorTraits<FileMappingAllocator<T> >::isTransferable(const FileMappingAllocator<T>&, const_pointer)
+{
+    return false;
+}
+
+template <typename T, typename Growth>
+MappedVector<T, Growth>::MappedVector(const char* path, const bool verify)
+    : MappedFileOwner(path, sizeof(T))
+    , Base(FileMappingAllocator<T>(&file_))
+{
+    const size_type count = file_.storedCount();
+    if (0 == file_.storedCapacity()) {
+        return;
+    }
+    Base::reserve(file_.storedCapacity());
+    Base::resize_uninitialized(count);
+    if (verify && MappedFile::checksum(&*Base::begin(), count * sizeof(T)) != file_.storedChecksum()) {
+        throw std::runtime_error("MappedVector: checksum mismatch");
+    }
+}
+
+template <typename T, typename Growth>
+MappedVector<T, Growth>::~MappedVector()
+{
+    try {
+        sync();
+    } catch (...) {
+    }
+}
+
+template <typename T, typename Growth>
+void
+MappedVector<T, Growth>::sync()
+{
+    const size_type count = Base::size();
+    const T* data = (0 == Base::capacity()) ? NULL : &*Base::begin();
+    file_.sync(count, Base::capacity(), MappedFile::checksum(data, count * sizeof(T)));
+}
+
+#endif /// __MAPPED_VECTOR_CPP__
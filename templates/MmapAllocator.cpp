@@ -0,0 +1,160 @@
+#ifndef __MMAP_ALLOCATOR_CPP__
+#define __MMAP_ALLOCATOR_CPP__
+
+#include "../headers/MmapAllocator.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+template <typename T, std::size_t Threshold>
+MmapAllocator<T, Threshold>::MmapAllocator()
+{}
+
+template <typename T, std::size_t Threshold>
+MmapAllocator<T, Threshold>::MmapAllocator(const MmapAllocator&)
+{}
+
+template <typename T, std::size_t Threshold>
+template <typename U>
+MmapAllocator<T, Threshold>::MmapAllocator(const MmapAllocator<U, Threshold>&)
+{}
+
+template <typename T, std::size_t Threshold>
+MmapAllocator<T, Threshold>::~MmapAllocator()
+{}
+
+template <typename T, std::size_t Threshold>
+bool
+MmapAllocator<T, Threshold>::isMapped(const size_type n)
+{
+    return n * sizeof(T) >= Threshold;
+}
+
+template <typename T, std::size_t Threshold>
+typename MmapAllocator<T, Threshold>::pointer
+MmapAllocator<T, Threshold>::allocate(const size_type n, const void*)
+{
+    if (n > max_size()) {
+        throw std::bad_alloc();
+    }
+    if (isMapped(n)) {
+        return static_cast<pointer>(PageMapping::map(PageMapping::roundUp(n * sizeof(T))));
+    }
+    void* p = ::malloc(n * sizeof(T));
+    if (NULL == p && n != 0) {
+        throw std::bad_alloc();
+    }
+    return static_cast<pointer>(p);
+}
+
+template <typename T, std::size_t Threshold>
+void
+MmapAllocator<T, Threshold>::deallocate(pointer p, const size_type n)
+{
+    if (isMapped(n)) {
+        PageMapping::unmap(p, PageMapping::roundUp(n * sizeof(T)));
+        return;
+    }
+    ::free(p);
+}
+
+template <typename T, std::size_t Threshold>
+typename MmapAllocator<T, Threshold>::size_type
+MmapAllocator<T, Threshold>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T) / 2;
+}
+
+template <typename T, std::size_t Threshold>
+void
+MmapAllocator<T, Threshold>::construct(pointer p, const_reference value)
+{
+    new (p) T(value);
+}
+
+template <typename T, std::size_t Threshold>
+void
+MmapAllocator<T, Threshold>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T, std::size_t Threshold>
+typename MmapAllocator<T, Threshold>::pointer
+MmapAllocator<T, Threshold>::address(reference r) const
+{
+    return &r;
+}
+
+template <typename T, std::size_t Threshold>
+typename MmapAllocator<T, Threshold>::const_pointer
+MmapAllocator<T, Threshold>::address(const_reference r) const
+{
+    return &r;
+}
+
+template <typename T, typename U, std::size_t Threshold>
+bool
+operator==(const MmapAllocator<T, Threshold>&, const MmapAllocator<U, Threshold>&)
+{
+    return true;
+}
+
+template <typename T, typename U, std::size_t Threshold>
+bool
+operator!=(const MmapAllocator<T, Threshold>&, const MmapAllocator<U, Threshold>&)
+{
+    return false;
+}
+
+/// The reported capacity never moves a block across the threshold, so
+/// deallocate() always picks the same path as allocate() did.
+template <typename T, std::size_t Threshold>
+typename AllocatorTraits<MmapAllocator<T, Threshold> >::pointer
+AllocatorTraits<MmapAllocator<T, Threshold> >::allocateAtLeast(MmapAllocator<T, Threshold>& allocator, const size_type n, size_type& allocated)
+{
+    pointer p = allocator.allocate(n);
+    if (MmapAllocator<T, Threshold>::isMapped(n)) {
+        allocated = PageMapping::roundUp(n * sizeof(T)) / sizeof(T);
+        return p;
+    }
+    allocated = n;
+#ifdef __GLIBC__
+    if (p != NULL) {
+        const size_type usable = ::malloc_usable_size(p) / sizeof(T);
+        const size_type limit = (Threshold - 1) / sizeof(T);
+        allocated = (usable < limit) ? usable : limit;
+    }
+#endif
+    return p;
+}
+
+template <typename T, std::size_t Threshold>
+typename AllocatorTraits<MmapAllocator<T, Threshold> >::pointer
+AllocatorTraits<MmapAllocator<T, Threshold> >::reallocate(MmapAllocator<T, Threshold>&, pointer p, const size_type capacity, const size_type n, size_type& allocated)
+{
+    if (!MmapAllocator<T, Threshold>::isMapped(capacity) || !MmapAllocator<T, Threshold>::isMapped(n)) {
+        return NULL;
+    }
+    const std::size_t bytes = PageMapping::roundUp(n * sizeof(T));
+    void* moved = PageMapping::remap(p, PageMapping::roundUp(capacity * sizeof(T)), bytes);
+    if (NULL == moved) {
+        return NULL;
+    }
+    allocated = bytes / sizeof(T);
+    return static_cast<pointer>(moved);
+}
+
+template <typename T, std::size_t Threshold>
+bool
+AllocatorTraits<MmapAllocator<T, Threshold> >::isTransferable(const MmapAllocator<T, Threshold>&, const_pointer)
+{
+    return true;
+}
+
+#endif /// __MMAP_ALLOCATOR_CPP__
@@ -0,0 +1,244 @@
+#ifndef __PARALLEL_CPP__
+#define __PARALLEL_CPP__
+
+#include "../headers/Parallel.hpp"
+
+template <typename RandomIt>
+ChunkedRange<RandomIt>::ChunkedRange(RandomIt first, const std::size_t size, const std::size_t grain)
+    : first_(first)
+    , size_(size)
+    , grain_(0 == grain ? 1 : grain)
+{}
+
+template <typename RandomIt>
+std::size_t
+ChunkedRange<RandomIt>::chunks() const
+{
+    return (size_ + grain_ - 1) / grain_;
+}
+
+template <typename RandomIt>
+std::size_t
+ChunkedRange<RandomIt>::begin(const std::size_t chunk) const
+{
+    return chunk * grain_;
+}
+
+template <typename RandomIt>
+std::size_t
+ChunkedRange<RandomIt>::end(const std::size_t chunk) const
+{
+    return (size_ - chunk * grain_ < grain_) ? size_ : (chunk + 1) * grain_;
+}
+
+template <typename RandomIt>
+RandomIt
+ChunkedRange<RandomIt>::at(const std::size_t index) const
+{
+    return advance(first_, index);
+}
+
+template <typename RandomIt>
+template <typename Iterator>
+Iterator
+ChunkedRange<RandomIt>::advance(Iterator it, const std::size_t n)
+{
+    it += static_cast<std::ptrdiff_t>(n);
+    return it;
+}
+
+inline ThreadPool&
+selectPool(ThreadPool* pool)
+{
+    return (NULL == pool) ? ThreadPool::instance() : *pool;
+}
+
+template <typename RandomIt, typename Function>
+ForEachTask<RandomIt, Function>::ForEachTask(const ChunkedRange<RandomIt>& range, Function& f)
+    : range_(range)
+    , f_(f)
+{}
+
+template <typename RandomIt, typename Function>
+void
+ForEachTask<RandomIt, Function>::run(const std::size_t chunk)
+{
+    RandomIt it = range_.at(range_.begin(chunk));
+    for (std::size_t i = range_.begin(chunk), end = range_.end(chunk); i < end; ++i, ++it) {
+        f_(*it);
+    }
+}
+
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+TransformTask<RandomIt, OutputIt, UnaryOperation>::TransformTask(const ChunkedRange<RandomIt>& range, OutputIt out, UnaryOperation& op)
+    : range_(range)
+    , out_(out)
+    , op_(op)
+{}
+
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+void
+TransformTask<RandomIt, OutputIt, UnaryOperation>::run(const std::size_t chunk)
+{
+    RandomIt it = range_.at(range_.begin(chunk));
+    OutputIt out = ChunkedRange<RandomIt>::advance(out_, range_.begin(chunk));
+    for (std::size_t i = range_.begin(chunk), end = range_.end(chunk); i < end; ++i, ++it, ++out) {
+        *out = op_(*it);
+    }
+}
+
+template <typename RandomIt, typename T, typename BinaryOperation>
+ReduceTask<RandomIt, T, BinaryOperation>::ReduceTask(const ChunkedRange<RandomIt>& range, Vector<T>& partials, BinaryOperation& op)
+    : range_(range)
+    , partials_(partials)
+    , op_(op)
+{}
+
+template <typename RandomIt, typename T, typename BinaryOperation>
+void
+ReduceTask<RandomIt, T, BinaryOperation>::run(const std::size_t chunk)
+{
+    RandomIt it = range_.at(range_.begin(chunk));
+    T sum = *it;
+    ++it;
+    for (std::size_t i = range_.begin(chunk) + 1, end = range_.end(chunk); i < end; ++i, ++it) {
+        sum = op_(sum, *it);
+    }
+    *(partials_.begin() + chunk) = sum;
+}
+
+template <typename RandomIt, typename OutputIt, typename T, typename BinaryOperation>
+ScanTask<RandomIt, OutputIt, T, BinaryOperation>::ScanTask(const ChunkedRange<RandomIt>& range, OutputIt out, const Vector<T>& offsets, BinaryOperation& op)
+    : range_(range)
+    , out_(out)
+    , offsets_(offsets)
+    , op_(op)
+{}
+
+template <typename RandomIt, typename OutputIt, typename T, typename BinaryOperation>
+void
+ScanTask<RandomIt, OutputIt, T, BinaryOperation>::run(const std::size_t chunk)
+{
+    RandomIt it = range_.at(range_.begin(chunk));
+    OutputIt out = ChunkedRange<RandomIt>::advance(out_, range_.begin(chunk));
+    T sum = (0 == chunk) ? T(*it) : op_(offsets_[chunk - 1], *it);
+    *out = sum;
+    ++it;
+    ++out;
+    for (std::size_t i = range_.begin(chunk) + 1, end = range_.end(chunk); i < end; ++i, ++it, ++out) {
+        sum = op_(sum, *it);
+        *out = sum;
+    }
+}
+
+template <typename RandomIt, typename Function>
+void
+parallel_for_each(RandomIt first, RandomIt last, Function f, const std::size_t grain, ThreadPool* pool)
+{
+    const ChunkedRange<RandomIt> range(first, static_cast<std::size_t>(last - first), grain);
+    ForEachTask<RandomIt, Function> task(range, f);
+    selectPool(pool).run(task, range.chunks());
+}
+
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+OutputIt
+parallel_transform(RandomIt first, RandomIt last, OutputIt out, UnaryOperation op, const std::size_t grain, ThreadPool* pool)
+{
+    const std::size_t size = static_cast<std::size_t>(last - first);
+    const ChunkedRange<RandomIt> range(first, size, grain);
+    TransformTask<RandomIt, OutputIt, UnaryOperation> task(range, out, op);
+    selectPool(pool).run(task, range.chunks());
+    return ChunkedRange<RandomIt>::advance(out, size);
+}
+
+template <typename RandomIt, typename T, typename BinaryOperation>
+T
+parallel_reduce(RandomIt first, RandomIt last, T init, BinaryOperation op, const std::size_t grain, ThreadPool* pool)
+{
+    const ChunkedRange<RandomIt> range(first, static_cast<std::size_t>(last - first), grain);
+    Vector<T> partials(range.chunks(), init);
+    ReduceTask<RandomIt, T, BinaryOperation> task(range, partials, op);
+    selectPool(pool).run(task, range.chunks());
+    for (std::size_t chunk = 0; chunk < partials.size(); ++chunk) {
+        init = op(init, partials[chunk]);
+    }
+    return init;
+}
+
+template <typename RandomIt, typename OutputIt, typename BinaryOperation>
+OutputIt
+parallel_inclusive_scan(RandomIt first, RandomIt last, OutputIt out, BinaryOperation op, const std::size_t grain, ThreadPool* pool)
+{
+    typedef typename IteratorValue<RandomIt>::type T;
+    const std::size_t size = static_cast<std::size_t>(last - first);
+    if (0 == size) {
+        return out;
+    }
+    const ChunkedRange<RandomIt> range(first, size, grain);
+    ThreadPool& threads = selectPool(pool);
+    if (range.chunks() > 1 && threads.size() > 1) {
+        Vector<T> offsets(range.chunks(), T(*first));
+        ReduceTask<RandomIt, T, BinaryOperation> totals(range, offsets, op);
+        threads.run(totals, range.chunks());
+        T* offset = &*offsets.begin();
+        for (std::size_t chunk = 1; chunk < offsets.size(); ++chunk) {
+            offset[chunk] = op(offset[chunk - 1], offset[chunk]);
+        }
+        ScanTask<RandomIt, OutputIt, T, BinaryOperation> scan(range, out, offsets, op);
+        threads.run(scan, range.chunks());
+        return ChunkedRange<RandomIt>::advance(out, size);
+    }
+    T sum = *first;
+    *out = sum;
+    ++first;
+    ++out;
+    for (; first != last; ++first, ++out) {
+        sum = op(sum, *first);
+        *out = sum;
+    }
+    return out;
+}
+
+template <typename T, typename Alloc, typename Growth, typename Function>
+void
+parallel_for_each(Vector<T, Alloc, Growth>& vector, Function f, const std::size_t grain, ThreadPool* pool)
+{
+    if (vector.size() != 0) {
+        T* first = &*vector.begin();
+        parallel_for_each(first, first + vector.size(), f, grain, pool);
+    }
+}
+
+template <typename T, typename Alloc, typename Growth, typename U, typename AllocU, typename GrowthU, typename UnaryOperation>
+void
+parallel_transform(const Vector<T, Alloc, Growth>& in, Vector<U, AllocU, GrowthU>& out, UnaryOperation op, const std::size_t grain, ThreadPool* pool)
+{
+    out.resize(in.size());
+    if (in.size() != 0) {
+        const T* first = &*in.begin();
+        parallel_transform(first, first + in.size(), &*out.begin(), op, grain, pool);
+    }
+}
+
+template <typename T, typename Alloc, typename Growth, typename U, typename BinaryOperation>
+U
+parallel_reduce(const Vector<T, Alloc, Growth>& vector, U init, BinaryOperation op, const std::size_t grain, ThreadPool* pool)
+{
+    if (0 == vector.size()) {
+        return init;
+    }
+    const T* first = &*vector.begin();
+    return parallel_reduce(first, first + vector.size(), init, op, grain, pool);
+}
+
+template <typename T, typename Alloc, typename Growth, typename BinaryOperation>
+void
+parallel_inclusive_scan(Vector<T, Alloc, Growth>& vector, BinaryOperation op, const std::size_t grain, ThreadPool* pool)
+{
+    if (vector.size() != 0) {
+        T* first = &*vector.begin();
+        parallel_inclusive_scan(first, first + vector.size(), first, op, grain, pool);
+    }
+}
+
+#endif /// __PARALLEL_CPP__
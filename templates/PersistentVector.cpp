@@ -0,0 +1,761 @@
+#ifndef __PERSISTENT_VECTOR_CPP__
+#define __PERSISTENT_VECTOR_CPP__
+
+#include "../headers/PersistentVector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+template <typename T>
+PersistentVector<T>::const_iterator::const_iterator()
+    : vector_(NULL)
+    , index_(0)
+    , leaf_(NULL)
+    , leafStart_(0)
+{}
+
+template <typename T>
+PersistentVector<T>::const_iterator::const_iterator(const PersistentVector* vector, const size_type index)
+    : vector_(vector)
+    , index_(index)
+    , leaf_(NULL)
+    , leafStart_(0)
+{}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator::reference
+PersistentVector<T>::const_iterator::operator*() const
+{
+    const size_type physical = vector_->offset_ + index_;
+    if (NULL == leaf_ || physical - leafStart_ >= WIDTH) {
+        leafStart_ = physical & ~MASK;
+        leaf_ = vector_->leafFor(physical)->values();
+    }
+    return leaf_[physical - leafStart_];
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator::pointer
+PersistentVector<T>::const_iterator::operator->() const
+{
+    return &**this;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator::reference
+PersistentVector<T>::const_iterator::operator[](const difference_type n) const
+{
+    return *(*this + n);
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator&
+PersistentVector<T>::const_iterator::operator++()
+{
+    ++index_;
+    return *this;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator
+PersistentVector<T>::const_iterator::operator++(int)
+{
+    const_iterator old(*this);
+    ++index_;
+    return old;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator&
+PersistentVector<T>::const_iterator::operator--()
+{
+    --index_;
+    return *this;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator
+PersistentVector<T>::const_iterator::operator--(int)
+{
+    const_iterator old(*this);
+    --index_;
+    return old;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator&
+PersistentVector<T>::const_iterator::operator+=(const difference_type n)
+{
+    index_ += n;
+    return *this;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator&
+PersistentVector<T>::const_iterator::operator-=(const difference_type n)
+{
+    index_ -= n;
+    return *this;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator
+PersistentVector<T>::const_iterator::operator+(const difference_type n) const
+{
+    const_iterator result(*this);
+    result += n;
+    return result;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator
+PersistentVector<T>::const_iterator::operator-(const difference_type n) const
+{
+    const_iterator result(*this);
+    result -= n;
+    return result;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator::difference_type
+PersistentVector<T>::const_iterator::operator-(const const_iterator& rhv) const
+{
+    return static_cast<difference_type>(index_) - static_cast<difference_type>(rhv.index_);
+}
+
+template <typename T>
+bool
+PersistentVector<T>::const_iterator::operator==(const const_iterator& rhv) const
+{
+    return index_ == rhv.index_;
+}
+
+template <typename T>
+bool
+PersistentVector<T>::const_iterator::operator!=(const const_iterator& rhv) const
+{
+    return index_ != rhv.index_;
+}
+
+template <typename T>
+bool
+PersistentVector<T>::const_iterator::operator<(const const_iterator& rhv) const
+{
+    return index_ < rhv.index_;
+}
+
+template <typename T>
+bool
+PersistentVector<T>::const_iterator::operator<=(const const_iterator& rhv) const
+{
+    return index_ <= rhv.index_;
+}
+
+template <typename T>
+bool
+PersistentVector<T>::const_iterator::operator>(const const_iterator& rhv) const
+{
+    return index_ > rhv.index_;
+}
+
+template <typename T>
+bool
+PersistentVector<T>::const_iterator::operator>=(const const_iterator& rhv) const
+{
+    return index_ >= rhv.index_;
+}
+
+template <typename T>
+T*
+PersistentVector<T>::Leaf::values()
+{
+    return reinterpret_cast<T*>(storage.bytes);
+}
+
+template <typename T>
+const T*
+PersistentVector<T>::Leaf::values() const
+{
+    return reinterpret_cast<const T*>(storage.bytes);
+}
+
+template <typename T>
+PersistentVector<T>::PersistentVector()
+    : root_(NULL)
+    , tail_(NULL)
+    , shift_(BITS)
+    , size_(0)
+    , offset_(0)
+{}
+
+template <typename T>
+template <typename Alloc, typename Growth>
+PersistentVector<T>::PersistentVector(const Vector<T, Alloc, Growth>& elements)
+    : root_(NULL)
+    , tail_(NULL)
+    , shift_(BITS)
+    , size_(0)
+    , offset_(0)
+{
+    try {
+        typedef typename Vector<T, Alloc, Growth>::const_iterator Iterator;
+        for (Iterator it = elements.begin(); it != elements.end(); ++it) {
+            append(*it);
+        }
+    } catch (...) {
+        releaseAll();
+        throw;
+    }
+}
+
+template <typename T>
+template <typename InputIterator>
+PersistentVector<T>::PersistentVector(InputIterator f, InputIterator l)
+    : root_(NULL)
+    , tail_(NULL)
+    , shift_(BITS)
+    , size_(0)
+    , offset_(0)
+{
+    try {
+        for (; f != l; ++f) {
+            append(*f);
+        }
+    } catch (...) {
+        releaseAll();
+        throw;
+    }
+}
+
+template <typename T>
+PersistentVector<T>::PersistentVector(const PersistentVector& rhv)
+    : root_(rhv.root_)
+    , tail_(rhv.tail_)
+    , shift_(rhv.shift_)
+    , size_(rhv.size_)
+    , offset_(rhv.offset_)
+{
+    retain(root_);
+    retain(tail_);
+}
+
+template <typename T>
+PersistentVector<T>::~PersistentVector()
+{
+    releaseAll();
+}
+
+template <typename T>
+PersistentVector<T>&
+PersistentVector<T>::operator=(const PersistentVector& rhv)
+{
+    PersistentVector copy(rhv);
+    swap(copy);
+    return *this;
+}
+
+template <typename T>
+void
+PersistentVector<T>::swap(PersistentVector& rhv)
+{
+    std::swap(root_, rhv.root_);
+    std::swap(tail_, rhv.tail_);
+    std::swap(shift_, rhv.shift_);
+    std::swap(size_, rhv.size_);
+    std::swap(offset_, rhv.offset_);
+}
+
+template <typename T>
+void
+swap(PersistentVector<T>& lhv, PersistentVector<T>& rhv)
+{
+    lhv.swap(rhv);
+}
+
+template <typename T>
+typename PersistentVector<T>::size_type
+PersistentVector<T>::size() const
+{
+    return size_ - offset_;
+}
+
+template <typename T>
+bool
+PersistentVector<T>::empty() const
+{
+    return size_ == offset_;
+}
+
+template <typename T>
+typename PersistentVector<T>::const_reference
+PersistentVector<T>::operator[](const size_type index) const
+{
+    assert(index < size());
+    const size_type physical = offset_ + index;
+    return leafFor(physical)->values()[physical & MASK];
+}
+
+template <typename T>
+typename PersistentVector<T>::const_reference
+PersistentVector<T>::front() const
+{
+    return (*this)[0];
+}
+
+template <typename T>
+typename PersistentVector<T>::const_reference
+PersistentVector<T>::back() const
+{
+    return (*this)[size() - 1];
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator
+PersistentVector<T>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template <typename T>
+typename PersistentVector<T>::const_iterator
+PersistentVector<T>::end() const
+{
+    return const_iterator(this, size());
+}
+
+template <typename T>
+bool
+PersistentVector<T>::operator==(const PersistentVector& rhv) const
+{
+    if (size() != rhv.size()) {
+        return false;
+    }
+    if (root_ == rhv.root_ && tail_ == rhv.tail_ && offset_ == rhv.offset_) {
+        return true;
+    }
+    return std::equal(begin(), end(), rhv.begin());
+}
+
+template <typename T>
+bool
+PersistentVector<T>::operator!=(const PersistentVector& rhv) const
+{
+    return !(*this == rhv);
+}
+
+template <typename T>
+PersistentVector<T>
+PersistentVector<T>::push_back(const_reference value) const
+{
+    PersistentVector result(*this);
+    result.append(value);
+    return result;
+}
+
+template <typename T>
+PersistentVector<T>
+PersistentVector<T>::pop_back() const
+{
+    assert(!empty());
+    return take(size() - 1);
+}
+
+template <typename T>
+PersistentVector<T>
+PersistentVector<T>::set(const size_type index, const_reference value) const
+{
+    assert(index < size());
+    const size_type physical = offset_ + index;
+    PersistentVector result(*this);
+    if (physical >= tailOffset()) {
+        Leaf* leaf = copyLeaf(tail_, tail_->count, physical & MASK, &value);
+        release(result.tail_, 0);
+        result.tail_ = leaf;
+    } else {
+        Branch* root = static_cast<Branch*>(assign(shift_, root_, physical, value));
+        release(result.root_, shift_);
+        result.root_ = root;
+    }
+    return result;
+}
+
+/// The new tail is the leaf holding the last kept element (shared when
+/// it is kept whole), and the trie is cut down to the full leaves before
+/// it, dropping root levels that are left with a single child.
+template <typename T>
+PersistentVector<T>
+PersistentVector<T>::take(const size_type n) const
+{
+    assert(n <= size());
+    if (n == size()) {
+        return *this;
+    }
+    PersistentVector result;
+    if (0 == n) {
+        return result;
+    }
+    const size_type size = offset_ + n;
+    const size_type offset = tailOffset(size);
+    const Leaf* last = leafFor(size - 1);
+    if (last->count == size - offset) {
+        result.tail_ = const_cast<Leaf*>(last);
+        retain(result.tail_);
+    } else {
+        result.tail_ = copyLeaf(last, size - offset, WIDTH, NULL);
+    }
+    result.size_ = size;
+    result.offset_ = offset_;
+    if (0 == offset) {
+        return result;
+    }
+    result.root_ = truncate(root_, shift_, offset);
+    result.shift_ = shift_;
+    while (result.shift_ > BITS && 1 == result.root_->count) {
+        Branch* child = static_cast<Branch*>(result.root_->children[0]);
+        retain(child);
+        release(result.root_, result.shift_);
+        result.root_ = child;
+        result.shift_ -= BITS;
+    }
+    return result;
+}
+
+template <typename T>
+PersistentVector<T>
+PersistentVector<T>::drop(const size_type n) const
+{
+    assert(n <= size());
+    if (n == size()) {
+        return PersistentVector();
+    }
+    PersistentVector result(*this);
+    result.offset_ += n;
+    const size_type offset = result.tailOffset();
+    if (result.root_ != NULL && result.offset_ >= offset) {
+        release(result.root_, result.shift_);
+        result.root_ = NULL;
+        result.shift_ = BITS;
+        result.offset_ -= offset;
+        result.size_ -= offset;
+    }
+    return result;
+}
+
+template <typename T>
+PersistentVector<T>
+PersistentVector<T>::slice(const size_type first, const size_type last) const
+{
+    assert(first <= last && last <= size());
+    return take(last).drop(first);
+}
+
+template <typename T>
+Vector<T>
+PersistentVector<T>::toVector() const
+{
+    Vector<T> out;
+    appendTo(out);
+    return out;
+}
+
+/// Copies leaf by leaf, so each run goes through Vector's contiguous
+/// range insertion.
+template <typename T>
+template <typename Alloc, typename Growth>
+void
+PersistentVector<T>::appendTo(Vector<T, Alloc, Growth>& out) const
+{
+    out.reserve(out.size() + size());
+    for (size_type physical = offset_; physical < size_; ) {
+        const T* values = leafFor(physical)->values();
+        const size_type first = physical & MASK;
+        const size_type count = std::min(WIDTH - first, size_ - physical);
+        out.insert(out.end(), values + first, values + first + count);
+        physical += count;
+    }
+}
+
+/// Appends in place: a tail that no other version shares is filled
+/// directly, a shared one is copied, a full one is moved into the trie.
+template <typename T>
+void
+PersistentVector<T>::append(const_reference value)
+{
+    if (tail_ != NULL && WIDTH == tail_->count) {
+        pushTailIntoTree();
+        Leaf* full = tail_;
+        tail_ = NULL;
+        release(full, 0);
+    }
+    if (tail_ != NULL && 1 == __atomic_load_n(&tail_->references, __ATOMIC_ACQUIRE)) {
+        new (tail_->values() + tail_->count) T(value);
+        ++tail_->count;
+    } else {
+        const size_type count = (NULL == tail_) ? 0 : tail_->count;
+        Leaf* leaf = copyLeaf(tail_, count, count, &value);
+        release(tail_, 0);
+        tail_ = leaf;
+    }
+    ++size_;
+}
+
+/// The full tail becomes the trie's last leaf; the trie gets its own
+/// reference to it.
+template <typename T>
+void
+PersistentVector<T>::pushTailIntoTree()
+{
+    if (NULL == root_) {
+        root_ = newBranch();
+        retain(tail_);
+        root_->children[0] = tail_;
+        root_->count = 1;
+        return;
+    }
+    if ((size_ >> BITS) > (static_cast<size_type>(1) << shift_)) {
+        Node* path = newPath(shift_, tail_);
+        Branch* root = NULL;
+        try {
+            root = newBranch();
+        } catch (...) {
+            release(path, shift_);
+            throw;
+        }
+        root->children[0] = root_;
+        root->children[1] = path;
+        root->count = 2;
+        root_ = root;
+        shift_ += BITS;
+        return;
+    }
+    Branch* root = pushTail(shift_, root_, tail_, size_ - 1);
+    release(root_, shift_);
+    root_ = root;
+}
+
+template <typename T>
+void
+PersistentVector<T>::releaseAll()
+{
+    release(root_, shift_);
+    release(tail_, 0);
+    root_ = NULL;
+    tail_ = NULL;
+}
+
+template <typename T>
+typename PersistentVector<T>::size_type
+PersistentVector<T>::tailOffset() const
+{
+    return tailOffset(size_);
+}
+
+template <typename T>
+const typename PersistentVector<T>::Leaf*
+PersistentVector<T>::leafFor(const size_type physical) const
+{
+    if (physical >= tailOffset()) {
+        return tail_;
+    }
+    const Node* node = root_;
+    for (size_type shift = shift_; shift > 0; shift -= BITS) {
+        node = static_cast<const Branch*>(node)->children[(physical >> shift) & MASK];
+    }
+    return static_cast<const Leaf*>(node);
+}
+
+/// Index of the first element in the tail: the trie only holds full leaves.
+template <typename T>
+typename PersistentVector<T>::size_type
+PersistentVector<T>::tailOffset(const size_type size)
+{
+    return (size < WIDTH) ? 0 : ((size - 1) >> BITS) << BITS;
+}
+
+template <typename T>
+void
+PersistentVector<T>::retain(Node* node)
+{
+    if (node != NULL) {
+        __atomic_add_fetch(&node->references, 1, __ATOMIC_RELAXED);
+    }
+}
+
+/// shift is 0 for leaves, otherwise the shift of the branch's level.
+template <typename T>
+void
+PersistentVector<T>::release(Node* node, const size_type shift)
+{
+    if (NULL == node || __atomic_sub_fetch(&node->references, 1, __ATOMIC_ACQ_REL) != 0) {
+        return;
+    }
+    if (0 == shift) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        Destroyer<T>::destroy(leaf->values(), leaf->values() + leaf->count);
+        delete leaf;
+        return;
+    }
+    Branch* branch = static_cast<Branch*>(node);
+    for (size_type i = 0; i < branch->count; ++i) {
+        release(branch->children[i], shift - BITS);
+    }
+    delete branch;
+}
+
+template <typename T>
+typename PersistentVector<T>::Branch*
+PersistentVector<T>::newBranch()
+{
+    Branch* branch = new Branch;
+    branch->references = 1;
+    branch->count = 0;
+    return branch;
+}
+
+/// A new branch that shares source's children, or an empty one.
+template <typename T>
+typename PersistentVector<T>::Branch*
+PersistentVector<T>::copyBranch(const Branch* source)
+{
+    Branch* branch = newBranch();
+    if (source != NULL) {
+        for (size_type i = 0; i < source->count; ++i) {
+            branch->children[i] = source->children[i];
+            retain(branch->children[i]);
+        }
+        branch->count = source->count;
+    }
+    return branch;
+}
+
+/// Copies the first count elements of source, with element replaced taken
+/// from value instead; replaced == count appends value.
+template <typename T>
+typename PersistentVector<T>::Leaf*
+PersistentVector<T>::copyLeaf(const Leaf* source, const size_type count, const size_type replaced, const T* value)
+{
+    Leaf* leaf = new Leaf;
+    leaf->references = 1;
+    leaf->count = 0;
+    const size_type total = (replaced == count) ? count + 1 : count;
+    try {
+        for (; leaf->count < total; ++leaf->count) {
+            const T& element = (leaf->count == replaced) ? *value : source->values()[leaf->count];
+            new (leaf->values() + leaf->count) T(element);
+        }
+    } catch (...) {
+        release(leaf, 0);
+        throw;
+    }
+    return leaf;
+}
+
+/// A chain of single-child branches from level shift down to leaf.
+template <typename T>
+typename PersistentVector<T>::Node*
+PersistentVector<T>::newPath(const size_type shift, Leaf* leaf)
+{
+    if (0 == shift) {
+        retain(leaf);
+        return leaf;
+    }
+    Node* child = newPath(shift - BITS, leaf);
+    Branch* branch = NULL;
+    try {
+        branch = newBranch();
+    } catch (...) {
+        release(child, shift - BITS);
+        throw;
+    }
+    branch->children[0] = child;
+    branch->count = 1;
+    return branch;
+}
+
+/// Copy of parent with tail added as the leaf for elements up to last.
+template <typename T>
+typename PersistentVector<T>::Branch*
+PersistentVector<T>::pushTail(const size_type shift, const Branch* parent, Leaf* tail, const size_type last)
+{
+    const size_type index = (last >> shift) & MASK;
+    Node* child = NULL;
+    if (BITS == shift) {
+        retain(tail);
+        child = tail;
+    } else if (parent != NULL && index < parent->count) {
+        child = pushTail(shift - BITS, static_cast<const Branch*>(parent->children[index]), tail, last);
+    } else {
+        child = newPath(shift - BITS, tail);
+    }
+    Branch* branch = NULL;
+    try {
+        branch = copyBranch(parent);
+    } catch (...) {
+        release(child, shift - BITS);
+        throw;
+    }
+    if (index < branch->count) {
+        release(branch->children[index], shift - BITS);
+    } else {
+        branch->count = index + 1;
+    }
+    branch->children[index] = child;
+    return branch;
+}
+
+/// Path copy of node with the element at physical replaced by value.
+template <typename T>
+typename PersistentVector<T>::Node*
+PersistentVector<T>::assign(const size_type shift, const Node* node, const size_type physical, const_reference value)
+{
+    if (0 == shift) {
+        return copyLeaf(static_cast<const Leaf*>(node), WIDTH, physical & MASK, &value);
+    }
+    const Branch* source = static_cast<const Branch*>(node);
+    const size_type index = (physical >> shift) & MASK;
+    Node* child = assign(shift - BITS, source->children[index], physical, value);
+    Branch* branch = NULL;
+    try {
+        branch = copyBranch(source);
+    } catch (...) {
+        release(child, shift - BITS);
+        throw;
+    }
+    release(branch->children[index], shift - BITS);
+    branch->children[index] = child;
+    return branch;
+}
+
+/// Copy of node that keeps its first count elements (a positive multiple
+/// of WIDTH), sharing every subtree that is kept whole.
+template <typename T>
+typename PersistentVector<T>::Branch*
+PersistentVector<T>::truncate(const Branch* node, const size_type shift, const size_type count)
+{
+    const size_type last = (count - 1) >> shift;
+    Node* child = NULL;
+    if (BITS == shift) {
+        child = node->children[last];
+        retain(child);
+    } else {
+        child = truncate(static_cast<const Branch*>(node->children[last]), shift - BITS,
+                         count - (last << shift));
+    }
+    Branch* branch = NULL;
+    try {
+        branch = newBranch();
+    } catch (...) {
+        release(child, shift - BITS);
+        throw;
+    }
+    for (size_type i = 0; i < last; ++i) {
+        branch->children[i] = node->children[i];
+        retain(branch->children[i]);
+    }
+    branch->children[last] = child;
+    branch->count = last + 1;
+    return branch;
+}
+
+#endif /// __PERSISTENT_VECTOR_CPP__
@@ -0,0 +1,116 @@
+#ifndef __POOL_ALLOCATOR_CPP__
+#define __POOL_ALLOCATOR_CPP__
+
+#include "../headers/PoolAllocator.hpp"
+
+#include <limits>
+#include <new>
+
+template <typename T>
+PoolAllocator<T>::PoolAllocator(FixedPool& pool)
+    : pool_(&pool)
+{}
+
+template <typename T>
+PoolAllocator<T>::PoolAllocator(const PoolAllocator& rhv)
+    : pool_(rhv.pool_)
+{}
+
+template <typename T>
+template <typename U>
+PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& rhv)
+    : pool_(rhv.pool())
+{}
+
+template <typename T>
+PoolAllocator<T>::~PoolAllocator()
+{}
+
+template <typename T>
+typename PoolAllocator<T>::pointer
+PoolAllocator<T>::allocate(const size_type n, const void*)
+{
+    if (n > max_size()) {
+        throw std::bad_alloc();
+    }
+    if (fitsChunk(n)) {
+        return static_cast<pointer>(pool_->allocate());
+    }
+    return static_cast<pointer>(::operator new(n * sizeof(T)));
+}
+
+template <typename T>
+void
+PoolAllocator<T>::deallocate(pointer p, const size_type n)
+{
+    if (fitsChunk(n)) {
+        pool_->deallocate(p);
+        return;
+    }
+    ::operator delete(p);
+}
+
+template <typename T>
+typename PoolAllocator<T>::size_type
+PoolAllocator<T>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T>
+void
+PoolAllocator<T>::construct(pointer p, const_reference value)
+{
+    new (p) T(value);
+}
+
+template <typename T>
+void
+PoolAllocator<T>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T>
+typename PoolAllocator<T>::pointer
+PoolAllocator<T>::address(reference r) const
+{
+    return &r;
+}
+
+template <typename T>
+typename PoolAllocator<T>::const_pointer
+PoolAllocator<T>::address(const_reference r) const
+{
+    return &r;
+}
+
+template <typename T>
+FixedPool*
+PoolAllocator<T>::pool() const
+{
+    return pool_;
+}
+
+template <typename T>
+bool
+PoolAllocator<T>::fitsChunk(const size_type n) const
+{
+    return n * sizeof(T) <= pool_->chunkSize();
+}
+
+template <typename T, typename U>
+bool
+operator==(const PoolAllocator<T>& lhv, const PoolAllocator<U>& rhv)
+{
+    return lhv.pool() == rhv.pool();
+}
+
+template <typename T, typename U>
+bool
+operator!=(const PoolAllocator<T>& lhv, const PoolAllocator<U>& rhv)
+{
+    return !(lhv == rhv);
+}
+
+#endif /// __POOL_ALLOCATOR_CPP__
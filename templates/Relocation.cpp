@@ -0,0 +1,260 @@
+#ifndef __RELOCATION_CPP__
+#define __RELOCATION_CPP__
+
+#include "../headers/Relocation.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+template <typename T>
+void
+Relocator<T, RELOCATE_BITWISE>::relocate(T* dst, T* src, const std::size_t n)
+{
+    if (n != 0) {
+        ::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+    }
+}
+
+template <typename T>
+void
+Relocator<T, RELOCATE_BITWISE>::relocateAround(T* dst, T* src, const std::size_t n, const std::size_t index, const std::size_t gap)
+{
+    relocate(dst, src, index);
+    relocate(dst + index + gap, src + index, n - index);
+}
+
+template <typename T>
+void
+Relocator<T, RELOCATE_BITWISE>::relocateBackward(T* dst, T* src, const std::size_t n)
+{
+    if (n != 0) {
+        ::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+    }
+}
+
+template <typename T>
+void
+Relocator<T, RELOCATE_BITWISE>::relocateForward(T* dst, T* src, const std::size_t n)
+{
+    if (n != 0) {
+        ::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+    }
+}
+
+#if __cplusplus >= 201103L
+template <typename T>
+void
+Relocator<T, RELOCATE_MOVE>::relocate(T* dst, T* src, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        new (dst + i) T(std::move(src[i]));
+        src[i].~T();
+    }
+}
+
+template <typename T>
+void
+Relocator<T, RELOCATE_MOVE>::relocateAround(T* dst, T* src, const std::size_t n, const std::size_t index, const std::size_t gap)
+{
+    relocate(dst, src, index);
+    relocate(dst + index + gap, src + index, n - index);
+}
+
+template <typename T>
+void
+Relocator<T, RELOCATE_MOVE>::relocateBackward(T* dst, T* src, const std::size_t n)
+{
+    for (std::size_t i = n; i > 0; --i) {
+        new (dst + i - 1) T(std::move(src[i - 1]));
+        src[i - 1].~T();
+    }
+}
+
+template <typename T>
+void
+Relocator<T, RELOCATE_MOVE>::relocateForward(T* dst, T* src, const std::size_t n)
+{
+    relocate(dst, src, n);
+}
+#endif
+
+/// Copies everything before destroying anything, so a throwing copy
+/// constructor leaves the source range intact.
+template <typename T>
+void
+Relocator<T, RELOCATE_COPY>::relocate(T* dst, T* src, const std::size_t n)
+{
+    Copier<T>::construct(dst, src, n);
+    Destroyer<T>::destroy(src, src + n);
+}
+
+template <typename T>
+void
+Relocator<T, RELOCATE_COPY>::relocateAround(T* dst, T* src, const std::size_t n, const std::size_t index, const std::size_t gap)
+{
+    Copier<T>::construct(dst, src, index);
+    try {
+        Copier<T>::construct(dst + index + gap, src + index, n - index);
+    } catch (...) {
+        Destroyer<T>::destroy(dst, dst + index);
+        throw;
+    }
+    Destroyer<T>::destroy(src, src + n);
+}
+
+/// The slots past the source are copy-constructed, the overlap is shifted
+/// by assignment and only then are the vacated slots destroyed, so no slot
+/// of the source range is ever dead while a copy may still throw.
+template <typename T>
+void
+Relocator<T, RELOCATE_COPY>::relocateBackward(T* dst, T* src, const std::size_t n)
+{
+    const std::size_t shift = dst - src;
+    if (shift >= n) {
+        relocate(dst, src, n);
+        return;
+    }
+    const std::size_t kept = n - shift;
+    Copier<T>::construct(src + n, src + kept, shift);
+    try {
+        std::copy_backward(src, src + kept, src + n);
+    } catch (...) {
+        Destroyer<T>::destroy(src + n, dst + n);
+        throw;
+    }
+    Destroyer<T>::destroy(src, dst);
+}
+
+template <typename T>
+void
+Relocator<T, RELOCATE_COPY>::relocateForward(T* dst, T* src, const std::size_t n)
+{
+    const std::size_t shift = src - dst;
+    if (shift >= n) {
+        relocate(dst, src, n);
+        return;
+    }
+    Copier<T>::construct(dst, src, shift);
+    try {
+        std::copy(src + shift, src + n, src);
+    } catch (...) {
+        Destroyer<T>::destroy(dst, src);
+        throw;
+    }
+    Destroyer<T>::destroy(dst + n, src + n);
+}
+
+template <typename T, bool Trivial>
+void
+Destroyer<T, Trivial>::destroy(T* first, T* last)
+{
+    for (; first != last; ++first) {
+        first->~T();
+    }
+}
+
+template <typename T>
+void
+Destroyer<T, true>::destroy(T*, T*)
+{
+}
+
+template <typename T, bool Trivial>
+void
+Copier<T, Trivial>::construct(T* dst, const T* src, const std::size_t n)
+{
+    std::size_t built = 0;
+    try {
+        for (; built < n; ++built) {
+            new (dst + built) T(src[built]);
+        }
+    } catch (...) {
+        Destroyer<T>::destroy(dst, dst + built);
+        throw;
+    }
+}
+
+template <typename T>
+void
+Copier<T, true>::construct(T* dst, const T* src, const std::size_t n)
+{
+    if (n != 0) {
+        ::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+    }
+}
+
+template <typename T, bool Trivial>
+void
+Filler<T, Trivial>::construct(T* dst, const std::size_t n, const T& value)
+{
+    std::size_t built = 0;
+    try {
+        for (; built < n; ++built) {
+            new (dst + built) T(value);
+        }
+    } catch (...) {
+        Destroyer<T>::destroy(dst, dst + built);
+        throw;
+    }
+}
+
+template <typename T>
+void
+Filler<T, true>::construct(T* dst, const std::size_t n, const T& value)
+{
+    if (0 == n) {
+        return;
+    }
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+    bool uniform = true;
+    for (std::size_t i = 1; i < sizeof(T) && uniform; ++i) {
+        uniform = bytes[i] == bytes[0];
+    }
+    if (uniform) {
+        ::memset(static_cast<void*>(dst), bytes[0], n * sizeof(T));
+        return;
+    }
+
+    /// Grow a pattern block of about 256 bytes in place, then stamp it out;
+    /// every memcpy source stays hot in L1.
+    const std::size_t PATTERN_BYTES = 256;
+    std::size_t block = 1;
+    ::memcpy(static_cast<void*>(dst), static_cast<const void*>(&value), sizeof(T));
+    while (block < n && 2 * block * sizeof(T) <= PATTERN_BYTES) {
+        const std::size_t count = (2 * block <= n) ? block : n - block;
+        ::memcpy(static_cast<void*>(dst + block), static_cast<const void*>(dst), count * sizeof(T));
+        block += count;
+    }
+    for (std::size_t done = block; done < n; done += block) {
+        const std::size_t count = (done + block <= n) ? block : n - done;
+        ::memcpy(static_cast<void*>(dst + done), static_cast<const void*>(dst), count * sizeof(T));
+    }
+}
+
+template <typename T, bool Trivial>
+void
+DefaultInitializer<T, Trivial>::construct(T* dst, const std::size_t n)
+{
+    std::size_t built = 0;
+    try {
+        for (; built < n; ++built) {
+            new (dst + built) T;
+        }
+    } catch (...) {
+        Destroyer<T>::destroy(dst, dst + built);
+        throw;
+    }
+}
+
+template <typename T>
+void
+DefaultInitializer<T, true>::construct(T*, const std::size_t)
+{
+}
+
+#endif /// __RELOCATION_CPP__
@@ -0,0 +1,484 @@
+#ifndef __SEGMENTED_VECTOR_CPP__
+#define __SEGMENTED_VECTOR_CPP__
+
+#include "../headers/SegmentedVector.hpp"
+
+#include <cassert>
+#include <new>
+#include <utility>
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::basic_iterator()
+    : container_(NULL)
+    , index_(0)
+{}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::basic_iterator(Container* container, const size_type index)
+    : container_(container)
+    , index_(index)
+{}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+template <typename OtherValue, typename OtherContainer>
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::basic_iterator(const basic_iterator<OtherValue, OtherContainer>& rhv)
+    : container_(rhv.container())
+    , index_(rhv.index())
+{}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>::reference
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator*() const
+{
+    return (*container_)[index_];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>::pointer
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator->() const
+{
+    return &(*container_)[index_];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>::reference
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator[](const difference_type n) const
+{
+    return (*container_)[index_ + n];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>&
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator++()
+{
+    ++index_;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator++(int)
+{
+    basic_iterator temp = *this;
+    ++index_;
+    return temp;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>&
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator--()
+{
+    --index_;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator--(int)
+{
+    basic_iterator temp = *this;
+    --index_;
+    return temp;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>&
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator+=(const difference_type n)
+{
+    index_ += n;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>&
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator-=(const difference_type n)
+{
+    index_ -= n;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator+(const difference_type n) const
+{
+    return basic_iterator(container_, index_ + n);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator-(const difference_type n) const
+{
+    return basic_iterator(container_, index_ - n);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::template basic_iterator<Value, Container>::difference_type
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator-(const basic_iterator& rhv) const
+{
+    return static_cast<difference_type>(index_) - static_cast<difference_type>(rhv.index_);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+bool
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator==(const basic_iterator& rhv) const
+{
+    return index_ == rhv.index_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+bool
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator!=(const basic_iterator& rhv) const
+{
+    return index_ != rhv.index_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+bool
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator<(const basic_iterator& rhv) const
+{
+    return index_ < rhv.index_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+bool
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator<=(const basic_iterator& rhv) const
+{
+    return index_ <= rhv.index_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+bool
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator>(const basic_iterator& rhv) const
+{
+    return index_ > rhv.index_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+bool
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::operator>=(const basic_iterator& rhv) const
+{
+    return index_ >= rhv.index_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+Container*
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::container() const
+{
+    return container_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename Value, typename Container>
+typename SegmentedVector<T, BlockSize, Alloc>::size_type
+SegmentedVector<T, BlockSize, Alloc>::basic_iterator<Value, Container>::index() const
+{
+    return index_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+SegmentedVector<T, BlockSize, Alloc>::SegmentedVector(const Alloc& allocator)
+    : blocks_()
+    , size_(0)
+    , allocator_(allocator)
+{}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+SegmentedVector<T, BlockSize, Alloc>::SegmentedVector(const size_type n, const_reference value, const Alloc& allocator)
+    : blocks_()
+    , size_(0)
+    , allocator_(allocator)
+{
+    resize(n, value);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+SegmentedVector<T, BlockSize, Alloc>::SegmentedVector(const SegmentedVector& rhv)
+    : blocks_()
+    , size_(0)
+    , allocator_(rhv.allocator_)
+{
+    reserve(rhv.size_);
+    for (size_type i = 0; i < rhv.size_; ++i) {
+        push_back(rhv[i]);
+    }
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+SegmentedVector<T, BlockSize, Alloc>::~SegmentedVector()
+{
+    clear();
+    shrink_to_fit();
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+SegmentedVector<T, BlockSize, Alloc>&
+SegmentedVector<T, BlockSize, Alloc>::operator=(const SegmentedVector& rhv)
+{
+    if (this != &rhv) {
+        SegmentedVector temp(rhv);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::swap(SegmentedVector& rhv)
+{
+    blocks_.swap(rhv.blocks_);
+    std::swap(size_, rhv.size_);
+    std::swap(allocator_, rhv.allocator_);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::size_type
+SegmentedVector<T, BlockSize, Alloc>::size() const
+{
+    return size_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+bool
+SegmentedVector<T, BlockSize, Alloc>::empty() const
+{
+    return 0 == size_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::size_type
+SegmentedVector<T, BlockSize, Alloc>::capacity() const
+{
+    return blocks_.size() * BlockSize;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::size_type
+SegmentedVector<T, BlockSize, Alloc>::blockCount() const
+{
+    return blocks_.size();
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::addBlock()
+{
+    /// The directory grows geometrically; the new slot is filled in place
+    /// once the block exists and dropped again if allocating it throws.
+    blocks_.push_back(NULL);
+    try {
+        *(blocks_.end() - 1) = allocator_.allocate(BlockSize);
+    } catch (...) {
+        blocks_.pop_back();
+        throw;
+    }
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::reserve(const size_type n)
+{
+    while (capacity() < n) {
+        addBlock();
+    }
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+T*
+SegmentedVector<T, BlockSize, Alloc>::slotFor(const size_type index)
+{
+    if (index == capacity()) {
+        addBlock();
+    }
+    return &(*this)[index];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::resize(const size_type n, const_reference value)
+{
+    while (size_ > n) {
+        pop_back();
+    }
+    reserve(n);
+    while (size_ < n) {
+        push_back(value);
+    }
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::push_back(const_reference element)
+{
+    new (slotFor(size_)) T(element);
+    ++size_;
+}
+
+#if __cplusplus >= 201103L
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::push_back(T&& element)
+{
+    new (slotFor(size_)) T(std::move(element));
+    ++size_;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+template <typename... Args>
+void
+SegmentedVector<T, BlockSize, Alloc>::emplace_back(Args&&... args)
+{
+    new (slotFor(size_)) T(std::forward<Args>(args)...);
+    ++size_;
+}
+#endif
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::pop_back()
+{
+    assert(size_ != 0);
+    --size_;
+    (*this)[size_].~T();
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::clear()
+{
+    for (size_type block = 0; block * BlockSize < size_; ++block) {
+        const size_type count = (size_ - block * BlockSize < BlockSize) ? size_ - block * BlockSize : BlockSize;
+        Destroyer<T>::destroy(blocks_[block], blocks_[block] + count);
+    }
+    size_ = 0;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+void
+SegmentedVector<T, BlockSize, Alloc>::shrink_to_fit()
+{
+    const size_type used = (size_ + BlockSize - 1) / BlockSize;
+    while (blocks_.size() > used) {
+        allocator_.deallocate(blocks_[blocks_.size() - 1], BlockSize);
+        blocks_.pop_back();
+    }
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::reference
+SegmentedVector<T, BlockSize, Alloc>::operator[](const size_type index)
+{
+    return blocks_[index / BlockSize][index % BlockSize];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::const_reference
+SegmentedVector<T, BlockSize, Alloc>::operator[](const size_type index) const
+{
+    return blocks_[index / BlockSize][index % BlockSize];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::reference
+SegmentedVector<T, BlockSize, Alloc>::front()
+{
+    assert(size_ != 0);
+    return (*this)[0];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::const_reference
+SegmentedVector<T, BlockSize, Alloc>::front() const
+{
+    assert(size_ != 0);
+    return (*this)[0];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::reference
+SegmentedVector<T, BlockSize, Alloc>::back()
+{
+    assert(size_ != 0);
+    return (*this)[size_ - 1];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::const_reference
+SegmentedVector<T, BlockSize, Alloc>::back() const
+{
+    assert(size_ != 0);
+    return (*this)[size_ - 1];
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::iterator
+SegmentedVector<T, BlockSize, Alloc>::begin()
+{
+    return iterator(this, 0);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::const_iterator
+SegmentedVector<T, BlockSize, Alloc>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::iterator
+SegmentedVector<T, BlockSize, Alloc>::end()
+{
+    return iterator(this, size_);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+typename SegmentedVector<T, BlockSize, Alloc>::const_iterator
+SegmentedVector<T, BlockSize, Alloc>::end() const
+{
+    return const_iterator(this, size_);
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+bool
+SegmentedVector<T, BlockSize, Alloc>::operator==(const SegmentedVector& rhv) const
+{
+    if (size_ != rhv.size_) {
+        return false;
+    }
+    for (size_type i = 0; i < size_; ++i) {
+        if (!((*this)[i] == rhv[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, std::size_t BlockSize, typename Alloc>
+bool
+SegmentedVector<T, BlockSize, Alloc>::operator!=(const SegmentedVector& rhv) const
+{
+    return !(*this == rhv);
+}
+#endif /// __SEGMENTED_VECTOR_CPP__
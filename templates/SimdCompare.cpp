@@ -0,0 +1,62 @@
+#ifndef __SIMD_COMPARE_CPP__
+#define __SIMD_COMPARE_CPP__
+
+#include "../headers/SimdCompare.hpp"
+
+#include <cstring>
+
+template <typename T, CompareKind Kind>
+bool
+RangeCompare<T, Kind>::equal(const T* a, const T* b, const std::size_t n)
+{
+    if (COMPARE_BYTES == Kind) {
+        return 0 == n || 0 == ::memcmp(a, b, n * sizeof(T));
+    }
+    return mismatch(a, b, n) == n;
+}
+
+template <typename T, CompareKind Kind>
+std::size_t
+RangeCompare<T, Kind>::mismatch(const T* a, const T* b, const std::size_t n)
+{
+    switch (Kind) {
+    case COMPARE_BYTES:
+        return mismatchBytes(a, b, n * sizeof(T)) / sizeof(T);
+    case COMPARE_FLOAT:
+        return mismatchFloats(reinterpret_cast<const float*>(a), reinterpret_cast<const float*>(b), n);
+    case COMPARE_DOUBLE:
+        return mismatchDoubles(reinterpret_cast<const double*>(a), reinterpret_cast<const double*>(b), n);
+    default:
+        break;
+    }
+    std::size_t i = 0;
+    while (i < n && a[i] == b[i]) {
+        ++i;
+    }
+    return i;
+}
+
+/// Elements that are neither equal nor ordered (NaN) do not decide the
+/// result, exactly as in std::lexicographical_compare.
+template <typename T, CompareKind Kind>
+bool
+RangeCompare<T, Kind>::less(const T* a, const std::size_t na, const T* b, const std::size_t nb)
+{
+    const std::size_t n = na < nb ? na : nb;
+    std::size_t i = 0;
+    while (true) {
+        i += mismatch(a + i, b + i, n - i);
+        if (i == n) {
+            return na < nb;
+        }
+        if (a[i] < b[i]) {
+            return true;
+        }
+        if (b[i] < a[i]) {
+            return false;
+        }
+        ++i;
+    }
+}
+
+#endif /// __SIMD_COMPARE_CPP__
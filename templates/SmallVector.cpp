@@ -0,0 +1,229 @@
+#ifndef __SMALL_VECTOR_CPP__
+#define __SMALL_VECTOR_CPP__
+
+#include "../headers/SmallVector.hpp"
+
+#include <limits>
+#include <new>
+
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+template <typename T, std::size_t N>
+SmallBufferAllocator<T, N>::SmallBufferAllocator()
+    : used_(false)
+{}
+
+template <typename T, std::size_t N>
+SmallBufferAllocator<T, N>::SmallBufferAllocator(const SmallBufferAllocator&)
+    : used_(false)
+{}
+
+template <typename T, std::size_t N>
+template <typename U>
+SmallBufferAllocator<T, N>::SmallBufferAllocator(const SmallBufferAllocator<U, N>&)
+    : used_(false)
+{}
+
+template <typename T, std::size_t N>
+SmallBufferAllocator<T, N>::~SmallBufferAllocator()
+{}
+
+/// The inline buffer belongs to this object, so there is nothing to assign.
+template <typename T, std::size_t N>
+SmallBufferAllocator<T, N>&
+SmallBufferAllocator<T, N>::operator=(const SmallBufferAllocator&)
+{
+    return *this;
+}
+
+template <typename T, std::size_t N>
+typename SmallBufferAllocator<T, N>::pointer
+SmallBufferAllocator<T, N>::allocate(const size_type n, const void*)
+{
+    if (!used_ && n <= N) {
+        used_ = true;
+        return inlineBuffer();
+    }
+    if (n > max_size()) {
+        throw std::bad_alloc();
+    }
+    return static_cast<pointer>(::operator new(n * sizeof(T)));
+}
+
+template <typename T, std::size_t N>
+void
+SmallBufferAllocator<T, N>::deallocate(pointer p, const size_type)
+{
+    if (isInline(p)) {
+        used_ = false;
+        return;
+    }
+    ::operator delete(p);
+}
+
+template <typename T, std::size_t N>
+typename SmallBufferAllocator<T, N>::size_type
+SmallBufferAllocator<T, N>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, std::size_t N>
+void
+SmallBufferAllocator<T, N>::construct(pointer p, const_reference value)
+{
+    new (p) T(value);
+}
+
+template <typename T, std::size_t N>
+void
+SmallBufferAllocator<T, N>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T, std::size_t N>
+typename SmallBufferAllocator<T, N>::pointer
+SmallBufferAllocator<T, N>::address(reference r) const
+{
+    return &r;
+}
+
+template <typename T, std::size_t N>
+typename SmallBufferAllocator<T, N>::const_pointer
+SmallBufferAllocator<T, N>::address(const_reference r) const
+{
+    return &r;
+}
+
+template <typename T, std::size_t N>
+bool
+SmallBufferAllocator<T, N>::isInline(const_pointer p) const
+{
+    return static_cast<const void*>(p) == static_cast<const void*>(buffer_);
+}
+
+template <typename T, std::size_t N>
+typename SmallBufferAllocator<T, N>::pointer
+SmallBufferAllocator<T, N>::inlineBuffer()
+{
+    return reinterpret_cast<pointer>(buffer_);
+}
+
+template <typename T, std::size_t N, typename U, std::size_t M>
+bool
+operator==(const SmallBufferAllocator<T, N>& lhv, const SmallBufferAllocator<U, M>& rhv)
+{
+    return static_cast<const void*>(&lhv) == static_cast<const void*>(&rhv);
+}
+
+template <typename T, std::size_t N, typename U, std::size_t M>
+bool
+operator!=(const SmallBufferAllocator<T, N>& lhv, const SmallBufferAllocator<U, M>& rhv)
+{
+    return !(lhv == rhv);
+}
+
+template <typename T, std::size_t N>
+typename AllocatorTraits<SmallBufferAllocator<T, N> >::pointer
+AllocatorTraits<SmallBufferAllocator<T, N> >::allocateAtLeast(SmallBufferAllocator<T, N>& allocator, const size_type n, size_type& allocated)
+{
+    pointer p = allocator.allocate(n);
+    allocated = allocator.isInline(p) ? N : n;
+    return p;
+}
+
+template <typename T, std::size_t N>
+typename AllocatorTraits<SmallBufferAllocator<T, N> >::pointer
+AllocatorTraits<SmallBufferAllocator<T, N> >::reallocate(SmallBufferAllocator<T, N>&, pointer, const size_type, const size_type, size_type&)
+{
+    return NULL;
+}
+
+template <typename T, std::size_t N>
+bool
+AllocatorTraits<SmallBufferAllocator<T, N> >::isTransferable(const SmallBufferAllocator<T, N>& allocator, const_pointer p)
+{
+    return !allocator.isInline(p);
+}
+
+template <typename T, std::size_t N, typename Growth>
+SmallVector<T, N, Growth>::SmallVector()
+    : Base()
+{
+    Base::reserve(N);
+}
+
+template <typename T, std::size_t N, typename Growth>
+SmallVector<T, N, Growth>::SmallVector(const size_type size)
+    : Base(size)
+{
+    Base::reserve(N);
+}
+
+template <typename T, std::size_t N, typename Growth>
+SmallVector<T, N, Growth>::SmallVector(const size_type n, const_reference t)
+    : Base(n, t)
+{
+    Base::reserve(N);
+}
+
+template <typename T, std::size_t N, typename Growth>
+SmallVector<T, N, Growth>::SmallVector(const int n, const_reference t)
+    : Base(n, t)
+{
+    Base::reserve(N);
+}
+
+template <typename T, std::size_t N, typename Growth>
+template <typename InputIterator>
+SmallVector<T, N, Growth>::SmallVector(InputIterator f, InputIterator l)
+    : Base()
+{
+    Base::reserve(N);
+    Base::insert(Base::end(), f, l);
+}
+
+template <typename T, std::size_t N, typename Growth>
+SmallVector<T, N, Growth>::SmallVector(const SmallVector& rhv)
+    : Base()
+{
+    Base::reserve(N);
+    Base::operator=(rhv);
+}
+
+template <typename T, std::size_t N, typename Growth>
+SmallVector<T, N, Growth>&
+SmallVector<T, N, Growth>::operator=(const SmallVector& rhv)
+{
+    Base::operator=(rhv);
+    return *this;
+}
+
+#if __cplusplus >= 201103L
+template <typename T, std::size_t N, typename Growth>
+SmallVector<T, N, Growth>::SmallVector(SmallVector&& rhv) noexcept(RelocationTraits<T>::kind != RELOCATE_COPY)
+    : Base(std::move(rhv))
+{
+    Base::reserve(N);
+}
+
+template <typename T, std::size_t N, typename Growth>
+SmallVector<T, N, Growth>&
+SmallVector<T, N, Growth>::operator=(SmallVector&& rhv) noexcept(RelocationTraits<T>::kind != RELOCATE_COPY)
+{
+    Base::operator=(std::move(rhv));
+    return *this;
+}
+#endif
+
+template <typename T, std::size_t N, typename Growth>
+bool
+SmallVector<T, N, Growth>::isInline() const
+{
+    return 0 == Base::size() || Base::allocatorRef().isInline(&*Base::begin());
+}
+
+#endif /// __SMALL_VECTOR_CPP__
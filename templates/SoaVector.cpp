@@ -0,0 +1,238 @@
+#ifndef __SOA_VECTOR_CPP__
+#define __SOA_VECTOR_CPP__
+
+#include "../headers/SoaVector.hpp"
+
+#include <cassert>
+
+template <typename F>
+void
+SoaColumnOps<F>::reserve(Vector<F>& column, const std::size_t n)
+{
+    column.reserve(n);
+}
+
+template <typename F>
+void
+SoaColumnOps<F>::resize(Vector<F>& column, const std::size_t n, const F& value)
+{
+    column.resize(n, value);
+}
+
+template <typename F>
+void
+SoaColumnOps<F>::push_back(Vector<F>& column, const F& value)
+{
+    column.push_back(value);
+}
+
+template <typename F>
+void
+SoaColumnOps<F>::pop_back(Vector<F>& column)
+{
+    column.pop_back();
+}
+
+template <typename F>
+void
+SoaColumnOps<F>::erase(Vector<F>& column, const std::size_t first, const std::size_t last)
+{
+    column.erase(column.begin() + first, column.begin() + last);
+}
+
+template <typename F>
+void
+SoaColumnOps<F>::clear(Vector<F>& column)
+{
+    column.clear();
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+SoaVector<F1, F2, F3, F4>::SoaVector()
+    : column0_()
+    , column1_()
+    , column2_()
+    , column3_()
+{}
+
+template <typename F1, typename F2, typename F3, typename F4>
+typename SoaVector<F1, F2, F3, F4>::size_type
+SoaVector<F1, F2, F3, F4>::size() const
+{
+    return column0_.size();
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+bool
+SoaVector<F1, F2, F3, F4>::empty() const
+{
+    return 0 == size();
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+void
+SoaVector<F1, F2, F3, F4>::reserve(const size_type n)
+{
+    SoaColumnOps<F1>::reserve(column0_, n);
+    SoaColumnOps<F2>::reserve(column1_, n);
+    SoaColumnOps<F3>::reserve(column2_, n);
+    SoaColumnOps<F4>::reserve(column3_, n);
+}
+
+/// Growing reserves every column first, so only element copies can throw.
+template <typename F1, typename F2, typename F3, typename F4>
+void
+SoaVector<F1, F2, F3, F4>::resize(const size_type n, const F1& f1, const F2& f2, const F3& f3, const F4& f4)
+{
+    if (n <= size()) {
+        erase(n, size());
+        return;
+    }
+    const size_type old = size();
+    reserve(n);
+    try {
+        SoaColumnOps<F1>::resize(column0_, n, f1);
+        SoaColumnOps<F2>::resize(column1_, n, f2);
+        SoaColumnOps<F3>::resize(column2_, n, f3);
+        SoaColumnOps<F4>::resize(column3_, n, f4);
+    } catch (...) {
+        SoaColumnOps<F1>::erase(column0_, old, column0_.size());
+        SoaColumnOps<F2>::erase(column1_, old, column1_.size());
+        SoaColumnOps<F3>::erase(column2_, old, column2_.size());
+        SoaColumnOps<F4>::erase(column3_, old, column3_.size());
+        throw;
+    }
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+void
+SoaVector<F1, F2, F3, F4>::push_back(const F1& f1, const F2& f2, const F3& f3, const F4& f4)
+{
+    int pushed = 0;
+    try {
+        SoaColumnOps<F1>::push_back(column0_, f1);
+        ++pushed;
+        SoaColumnOps<F2>::push_back(column1_, f2);
+        ++pushed;
+        SoaColumnOps<F3>::push_back(column2_, f3);
+        ++pushed;
+        SoaColumnOps<F4>::push_back(column3_, f4);
+    } catch (...) {
+        if (pushed > 2) {
+            SoaColumnOps<F3>::pop_back(column2_);
+        }
+        if (pushed > 1) {
+            SoaColumnOps<F2>::pop_back(column1_);
+        }
+        if (pushed > 0) {
+            SoaColumnOps<F1>::pop_back(column0_);
+        }
+        throw;
+    }
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+void
+SoaVector<F1, F2, F3, F4>::pop_back()
+{
+    assert(!empty());
+    SoaColumnOps<F1>::pop_back(column0_);
+    SoaColumnOps<F2>::pop_back(column1_);
+    SoaColumnOps<F3>::pop_back(column2_);
+    SoaColumnOps<F4>::pop_back(column3_);
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+void
+SoaVector<F1, F2, F3, F4>::erase(const size_type index)
+{
+    erase(index, index + 1);
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+void
+SoaVector<F1, F2, F3, F4>::erase(const size_type first, const size_type last)
+{
+    assert(first <= last && last <= size());
+    SoaColumnOps<F1>::erase(column0_, first, last);
+    SoaColumnOps<F2>::erase(column1_, first, last);
+    SoaColumnOps<F3>::erase(column2_, first, last);
+    SoaColumnOps<F4>::erase(column3_, first, last);
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+void
+SoaVector<F1, F2, F3, F4>::clear()
+{
+    SoaColumnOps<F1>::clear(column0_);
+    SoaColumnOps<F2>::clear(column1_);
+    SoaColumnOps<F3>::clear(column2_);
+    SoaColumnOps<F4>::clear(column3_);
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+void
+SoaVector<F1, F2, F3, F4>::swap(SoaVector& rhv)
+{
+    column0_.swap(rhv.column0_);
+    column1_.swap(rhv.column1_);
+    column2_.swap(rhv.column2_);
+    column3_.swap(rhv.column3_);
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+bool
+SoaVector<F1, F2, F3, F4>::operator==(const SoaVector& rhv) const
+{
+    return column0_ == rhv.column0_ && column1_ == rhv.column1_
+        && column2_ == rhv.column2_ && column3_ == rhv.column3_;
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+bool
+SoaVector<F1, F2, F3, F4>::operator!=(const SoaVector& rhv) const
+{
+    return !(*this == rhv);
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+template <std::size_t I>
+const typename SoaVector<F1, F2, F3, F4>::template field<I>::column_type&
+SoaVector<F1, F2, F3, F4>::column() const
+{
+    return SoaField<I, F1, F2, F3, F4>::get(column0_, column1_, column2_, column3_);
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+template <std::size_t I>
+typename SoaVector<F1, F2, F3, F4>::template field<I>::iterator
+SoaVector<F1, F2, F3, F4>::begin()
+{
+    return SoaField<I, F1, F2, F3, F4>::get(column0_, column1_, column2_, column3_).begin();
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+template <std::size_t I>
+typename SoaVector<F1, F2, F3, F4>::template field<I>::iterator
+SoaVector<F1, F2, F3, F4>::end()
+{
+    return SoaField<I, F1, F2, F3, F4>::get(column0_, column1_, column2_, column3_).end();
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+template <std::size_t I>
+const typename SoaVector<F1, F2, F3, F4>::template field<I>::type&
+SoaVector<F1, F2, F3, F4>::get(const size_type index) const
+{
+    return column<I>()[index];
+}
+
+template <typename F1, typename F2, typename F3, typename F4>
+template <std::size_t I>
+void
+SoaVector<F1, F2, F3, F4>::set(const size_type index, const typename field<I>::type& value)
+{
+    *(begin<I>() + index) = value;
+}
+
+#endif /// __SOA_VECTOR_CPP__
@@ -0,0 +1,422 @@
+#ifndef __STATIC_VECTOR_CPP__
+#define __STATIC_VECTOR_CPP__
+
+#include "../headers/StaticVector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+inline void
+OverflowAssert::overflow()
+{
+    assert(!"StaticVector capacity exceeded");
+}
+
+inline void
+OverflowFail::overflow()
+{
+}
+
+inline void
+OverflowDrop::overflow()
+{
+}
+
+template <typename T, std::size_t N>
+FixedBufferAllocator<T, N>::FixedBufferAllocator()
+{}
+
+template <typename T, std::size_t N>
+FixedBufferAllocator<T, N>::FixedBufferAllocator(const FixedBufferAllocator&)
+{}
+
+template <typename T, std::size_t N>
+template <typename U>
+FixedBufferAllocator<T, N>::FixedBufferAllocator(const FixedBufferAllocator<U, N>&)
+{}
+
+template <typename T, std::size_t N>
+FixedBufferAllocator<T, N>::~FixedBufferAllocator()
+{}
+
+/// The buffer belongs to this object, so there is nothing to assign.
+template <typename T, std::size_t N>
+FixedBufferAllocator<T, N>&
+FixedBufferAllocator<T, N>::operator=(const FixedBufferAllocator&)
+{
+    return *this;
+}
+
+template <typename T, std::size_t N>
+typename FixedBufferAllocator<T, N>::pointer
+FixedBufferAllocator<T, N>::allocate(const size_type n, const void*)
+{
+    if (n > N) {
+        throw std::bad_alloc();
+    }
+    return reinterpret_cast<pointer>(buffer_);
+}
+
+template <typename T, std::size_t N>
+void
+FixedBufferAllocator<T, N>::deallocate(pointer, const size_type)
+{
+}
+
+template <typename T, std::size_t N>
+typename FixedBufferAllocator<T, N>::size_type
+FixedBufferAllocator<T, N>::max_size() const
+{
+    return N;
+}
+
+template <typename T, std::size_t N>
+void
+FixedBufferAllocator<T, N>::construct(pointer p, const_reference value)
+{
+    new (p) T(value);
+}
+
+template <typename T, std::size_t N>
+void
+FixedBufferAllocator<T, N>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T, std::size_t N>
+typename FixedBufferAllocator<T, N>::pointer
+FixedBufferAllocator<T, N>::address(reference r) const
+{
+    return &r;
+}
+
+template <typename T, std::size_t N>
+typename FixedBufferAllocator<T, N>::const_pointer
+FixedBufferAllocator<T, N>::address(const_reference r) const
+{
+    return &r;
+}
+
+template <typename T, std::size_t N, typename U, std::size_t M>
+bool
+operator==(const FixedBufferAllocator<T, N>& lhv, const FixedBufferAllocator<U, M>& rhv)
+{
+    return static_cast<const void*>(&lhv) == static_cast<const void*>(&rhv);
+}
+
+template <typename T, std::size_t N, typename U, std::size_t M>
+bool
+operator!=(const FixedBufferAllocator<T, N>& lhv, const FixedBufferAllocator<U, M>& rhv)
+{
+    return !(lhv == rhv);
+}
+
+template <typename T, std::size_t N>
+typename AllocatorTraits<FixedBufferAllocator<T, N> >::pointer
+AllocatorTraits<FixedBufferAllocator<T, N> >::allocateAtLeast(FixedBufferAllocator<T, N>& allocator, const size_type n, size_type& allocated)
+{
+    allocated = N;
+    return allocator.allocate(n);
+}
+
+template <typename T, std::size_t N>
+typename AllocatorTraits<FixedBufferAllocator<T, N> >::pointer
+AllocatorTraits<FixedBufferAllocator<T, N> >::reallocate(FixedBufferAllocator<T, N>&, pointer, const size_type, const size_type, size_type&)
+{
+    return NULL;
+}
+
+template <typename T, std::size_t N>
+bool
+AllocatorTraits<FixedBufferAllocator<T, N> >::isTransferable(const FixedBufferAllocator<T, N>&, const_pointer)
+{
+    return false;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+StaticVector<T, N, Overflow>::StaticVector()
+    : Base()
+{
+    Base::reserve(N);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+StaticVector<T, N, Overflow>::StaticVector(const size_type size)
+    : Base()
+{
+    Base::reserve(N);
+    resize(size);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+StaticVector<T, N, Overflow>::StaticVector(const size_type n, const_reference t)
+    : Base()
+{
+    Base::reserve(N);
+    resize(n, t);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+StaticVector<T, N, Overflow>::StaticVector(const int n, const_reference t)
+    : Base()
+{
+    Base::reserve(N);
+    resize(static_cast<size_type>(n), t);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+template <typename InputIterator>
+StaticVector<T, N, Overflow>::StaticVector(InputIterator f, InputIterator l)
+    : Base()
+{
+    Base::reserve(N);
+    insert(Base::end(), f, l);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+StaticVector<T, N, Overflow>::StaticVector(const StaticVector& rhv)
+    : Base()
+{
+    Base::reserve(N);
+    Base::operator=(rhv);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+StaticVector<T, N, Overflow>&
+StaticVector<T, N, Overflow>::operator=(const StaticVector& rhv)
+{
+    Base::operator=(rhv);
+    return *this;
+}
+
+#if __cplusplus >= 201103L
+template <typename T, std::size_t N, typename Overflow>
+StaticVector<T, N, Overflow>::StaticVector(StaticVector&& rhv) noexcept(RelocationTraits<T>::kind != RELOCATE_COPY)
+    : Base(std::move(rhv))
+{
+    Base::reserve(N);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+StaticVector<T, N, Overflow>&
+StaticVector<T, N, Overflow>::operator=(StaticVector&& rhv) noexcept(RelocationTraits<T>::kind != RELOCATE_COPY)
+{
+    Base::operator=(std::move(rhv));
+    return *this;
+}
+#endif
+
+template <typename T, std::size_t N, typename Overflow>
+typename StaticVector<T, N, Overflow>::size_type
+StaticVector<T, N, Overflow>::max_size() const
+{
+    return N;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+bool
+StaticVector<T, N, Overflow>::full() const
+{
+    return Base::size() == N;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+bool
+StaticVector<T, N, Overflow>::reserve(const size_type n)
+{
+    if (n > N) {
+        Overflow::overflow();
+        return false;
+    }
+    return true;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+bool
+StaticVector<T, N, Overflow>::resize(const size_type n, const_reference init)
+{
+    if (n > N) {
+        Overflow::overflow();
+        if (Overflow::TRUNCATE) {
+            Base::resize(N, init);
+        }
+        return false;
+    }
+    Base::resize(n, init);
+    return true;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+bool
+StaticVector<T, N, Overflow>::resize_uninitialized(const size_type n)
+{
+    if (n > N) {
+        Overflow::overflow();
+        if (Overflow::TRUNCATE) {
+            Base::resize_uninitialized(N);
+        }
+        return false;
+    }
+    Base::resize_uninitialized(n);
+    return true;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+bool
+StaticVector<T, N, Overflow>::push_back(const_reference element)
+{
+    if (full()) {
+        Overflow::overflow();
+        return false;
+    }
+    Base::push_back(element);
+    return true;
+}
+
+#if __cplusplus >= 201103L
+template <typename T, std::size_t N, typename Overflow>
+bool
+StaticVector<T, N, Overflow>::push_back(value_type&& element)
+{
+    if (full()) {
+        Overflow::overflow();
+        return false;
+    }
+    Base::push_back(std::move(element));
+    return true;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+template <typename... Args>
+bool
+StaticVector<T, N, Overflow>::emplace_back(Args&&... args)
+{
+    if (full()) {
+        Overflow::overflow();
+        return false;
+    }
+    Base::emplace_back(std::forward<Args>(args)...);
+    return true;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+typename StaticVector<T, N, Overflow>::iterator
+StaticVector<T, N, Overflow>::insert(iterator pos, value_type&& x)
+{
+    if (full()) {
+        Overflow::overflow();
+        return Base::end();
+    }
+    return Base::insert(pos, std::move(x));
+}
+
+template <typename T, std::size_t N, typename Overflow>
+template <typename... Args>
+typename StaticVector<T, N, Overflow>::iterator
+StaticVector<T, N, Overflow>::emplace(iterator pos, Args&&... args)
+{
+    if (full()) {
+        Overflow::overflow();
+        return Base::end();
+    }
+    return Base::emplace(pos, std::forward<Args>(args)...);
+}
+#endif
+
+/// Returns end() when the element could not be stored.
+template <typename T, std::size_t N, typename Overflow>
+typename StaticVector<T, N, Overflow>::iterator
+StaticVector<T, N, Overflow>::insert(iterator pos, const_reference x)
+{
+    if (full()) {
+        Overflow::overflow();
+        return Base::end();
+    }
+    return Base::insert(pos, x);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+bool
+StaticVector<T, N, Overflow>::insert(iterator pos, const size_type n, const_reference x)
+{
+    if (n > room()) {
+        Overflow::overflow();
+        if (Overflow::TRUNCATE) {
+            Base::insert(pos, room(), x);
+        }
+        return false;
+    }
+    Base::insert(pos, n, x);
+    return true;
+}
+
+template <typename T, std::size_t N, typename Overflow>
+bool
+StaticVector<T, N, Overflow>::insert(iterator pos, const int n, const_reference x)
+{
+    assert(n >= 0);
+    return insert(pos, static_cast<size_type>(n), x);
+}
+
+template <typename T, std::size_t N, typename Overflow>
+template <typename InputIterator>
+bool
+StaticVector<T, N, Overflow>::insert(iterator pos, InputIterator f, InputIterator l)
+{
+    return rangeInsert(pos, f, l, IsIntegral<InputIterator>());
+}
+
+template <typename T, std::size_t N, typename Overflow>
+typename StaticVector<T, N, Overflow>::size_type
+StaticVector<T, N, Overflow>::room() const
+{
+    return N - Base::size();
+}
+
+template <typename T, std::size_t N, typename Overflow>
+template <typename Integer>
+bool
+StaticVector<T, N, Overflow>::rangeInsert(iterator pos, Integer n, Integer value, TrueType)
+{
+    return insert(pos, static_cast<size_type>(n), static_cast<value_type>(value));
+}
+
+/// Works for single-pass ranges without a scratch buffer: the new elements
+/// are appended while they fit and then rotated into place.
+template <typename T, std::size_t N, typename Overflow>
+template <typename InputIterator>
+bool
+StaticVector<T, N, Overflow>::rangeInsert(iterator pos, InputIterator f, InputIterator l, FalseType)
+{
+    iterator first = Base::begin();
+    const size_type index = pos - first;
+    const size_type oldSize = Base::size();
+    bool stored = true;
+    for (; f != l; ++f) {
+        if (full()) {
+            stored = false;
+            break;
+        }
+        Base::push_back(*f);
+    }
+    if (!stored) {
+        Overflow::overflow();
+        if (!Overflow::TRUNCATE) {
+            Base::erase(Base::begin() + oldSize, Base::end());
+            return false;
+        }
+    }
+    if (Base::size() != oldSize) {
+        T* const data = &*Base::begin();
+        std::rotate(data + index, data + oldSize, data + Base::size());
+    }
+    return stored;
+}
+
+#endif /// __STATIC_VECTOR_CPP__
@@ -3,16 +3,18 @@
 
 #include "../headers/Vector.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
-#include <cmath>
-#include <cstring>
+#include <new>
 
-const double RESERVE_COEFF = 2;
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 std::ostream&
-operator<<(std::ostream& out, const Vector<T>& vector)
+operator<<(std::ostream& out, const Vector<T, Alloc, Growth>& vector)
 {
     for (size_t i = 0; i < vector.size(); ++i) {
         out << vector[i] << " ";
@@ -20,593 +22,1079 @@ operator<<(std::ostream& out, const Vector<T>& vector)
     return out;
 }
 
-template <typename T>
-Vector<T>::Vector()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::Vector()
     : begin_(NULL)
     , end_(NULL)
     , bufferEnd_(NULL)
+    , allocator_()
 {}
 
-template <typename T>
-Vector<T>::Vector(const size_type size)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::Vector(const Alloc& allocator)
     : begin_(NULL)
     , end_(NULL)
     , bufferEnd_(NULL)
+    , allocator_(allocator)
+{}
+
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::Vector(const size_type size, const Alloc& allocator)
+    : begin_(NULL)
+    , end_(NULL)
+    , bufferEnd_(NULL)
+    , allocator_(allocator)
 {
     resize(size);
 }
 
-template <typename T>
-Vector<T>::Vector(const size_type n, const_reference t)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::Vector(const size_type n, const_reference t, const Alloc& allocator)
     : begin_(NULL)
     , end_(NULL)
     , bufferEnd_(NULL)
+    , allocator_(allocator)
 {
     resize(n, t);
 }
 
-template <typename T>
-Vector<T>::Vector(const int n, const_reference t)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::Vector(const int n, const_reference t, const Alloc& allocator)
         : begin_(NULL)
         , end_(NULL)
         , bufferEnd_(NULL)
+        , allocator_(allocator)
 {
     resize(n, t);
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 template <typename InputIterator>
-Vector<T>::Vector(InputIterator f, InputIterator l)
+Vector<T, Alloc, Growth>::Vector(InputIterator f, InputIterator l, const Alloc& allocator)
+    : begin_(NULL)
+    , end_(NULL)
+    , bufferEnd_(NULL)
+    , allocator_(allocator)
+{
+    rangeInsert(0, f, l, IsIntegral<InputIterator>());
+}
+
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::Vector(const Vector& rhv)
+    : begin_(NULL)
+    , end_(NULL)
+    , bufferEnd_(NULL)
+    , allocator_(rhv.allocator_)
+{
+    reserve(rhv.size());
+    Copier<T>::construct(begin_, rhv.begin_, rhv.size());
+    end_ = begin_ + rhv.size();
+    VECTOR_STATS_HOOK(Vector, copied(rhv.size()));
+}
+
+#if __cplusplus >= 201103L
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::Vector(Vector&& rhv) noexcept(AllocatorTraits<Alloc>::ALWAYS_TRANSFERABLE)
     : begin_(NULL)
     , end_(NULL)
     , bufferEnd_(NULL)
+    , allocator_(rhv.allocator_)
+{
+    takeFrom(rhv);
+}
+
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>&
+Vector<T, Alloc, Growth>::operator=(Vector&& rhv) noexcept(AllocatorTraits<Alloc>::ALWAYS_TRANSFERABLE)
+{
+    Vector temp(std::move(rhv));
+    swap(temp);
+    return *this;
+}
+#endif
+
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>&
+Vector<T, Alloc, Growth>::operator=(const Vector& rhv)
 {
-    while (f != l) {
-        push_back(*(f));
-        ++f;
+    if (this == &rhv) {
+        return *this;
     }
+    clear();
+    reserve(rhv.size());
+    Copier<T>::construct(begin_, rhv.begin_, rhv.size());
+    end_ = begin_ + rhv.size();
+    VECTOR_STATS_HOOK(Vector, copied(rhv.size()));
+    return *this;
 }
 
-template <typename T>
-Vector<T>::~Vector()
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::swap(Vector& rhv) VECTOR_NOEXCEPT_IF(AllocatorTraits<Alloc>::ALWAYS_TRANSFERABLE)
+{
+    if (!isTransferable() || !rhv.isTransferable()) {
+        Vector temp(allocator_);
+        temp.takeFrom(*this);
+        takeFrom(rhv);
+        rhv.takeFrom(temp);
+        return;
+    }
+    std::swap(begin_, rhv.begin_);
+    std::swap(end_, rhv.end_);
+    std::swap(bufferEnd_, rhv.bufferEnd_);
+    std::swap(allocator_, rhv.allocator_);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+swap(Vector<T, Alloc, Growth>& lhv, Vector<T, Alloc, Growth>& rhv) VECTOR_NOEXCEPT_IF(AllocatorTraits<Alloc>::ALWAYS_TRANSFERABLE)
+{
+    lhv.swap(rhv);
+}
+
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::~Vector()
 {
     if (begin_ != NULL) {
-        for (size_type i = 1 ; i < size(); ++i) {
-            (end_ - i)->~T();
-        }
-        ::operator delete[](begin_);
+        VECTOR_STATS_HOOK(Vector, destroyed(size(), capacity()));
+        Destroyer<T>::destroy(begin_, end_);
+        allocator_.deallocate(begin_, capacity());
         begin_ = NULL;
         end_ = NULL;
         bufferEnd_ = NULL;
     }
 }
 
-template <typename T>
-typename Vector<T>::size_type
-Vector<T>::size() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::allocator_type
+Vector<T, Alloc, Growth>::get_allocator() const
+{
+    return allocator_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+const Alloc&
+Vector<T, Alloc, Growth>::allocatorRef() const
+{
+    return allocator_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::size_type
+Vector<T, Alloc, Growth>::size() const
 {
     return end_ - begin_;
 }
 
-template <typename T>
-typename Vector<T>::size_type
-Vector<T>::max_size() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::size_type
+Vector<T, Alloc, Growth>::max_size() const
 {
     return std::numeric_limits<size_type>::max();
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 void
-Vector<T>::resize(const Vector::size_type n, const T& init)
+Vector<T, Alloc, Growth>::resize(const Vector::size_type n, const T& init)
 {
+    VECTOR_STATS_HOOK(Vector, resized());
+    if (n < size()) {
+        Destroyer<T>::destroy(begin_ + n, end_);
+        end_ = begin_ + n;
+        shrinkIfSparse();
+        return;
+    }
     if (n > capacity()) {
+        if (contains(&init)) {
+            const T copy(init);
+            resize(n, copy);
+            return;
+        }
         reserve(n);
     }
-    const size_type oldSize = size();
-    for (size_type i = n; i < oldSize; ++i) {
-        (end_--)->~T();
-    }
+    Filler<T>::construct(end_, n - size(), init);
+    end_ = begin_ + n;
+}
 
+/// Like resize(n), but new elements are default-initialized: for trivial
+/// types their bytes are left as they are, ready to be overwritten.
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::resize_uninitialized(const size_type n)
+{
+    VECTOR_STATS_HOOK(Vector, resized());
+    if (n < size()) {
+        Destroyer<T>::destroy(begin_ + n, end_);
+        end_ = begin_ + n;
+        shrinkIfSparse();
+        return;
+    }
+    reserve(n);
+    DefaultInitializer<T>::construct(end_, n - size());
     end_ = begin_ + n;
-    for (size_type i = oldSize; i < n; ++i) {
-        new (begin_ + i) T(init);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::push_back(const_reference element)
+{
+    if (end_ == bufferEnd_) {
+        if (contains(&element)) {
+            const T copy(element);
+            reserve(nextCapacity(size() + 1));
+            new (end_) T(copy);
+            ++end_;
+            return;
+        }
+        reserve(nextCapacity(size() + 1));
     }
+    new (end_) T(element);
+    ++end_;
 }
 
-template <typename T>
+#if __cplusplus >= 201103L
+template <typename T, typename Alloc, typename Growth>
 void
-Vector<T>::push_back(const_reference element)
+Vector<T, Alloc, Growth>::push_back(value_type&& element)
 {
-    const size_type oldCapacity = capacity();
-    const size_type oldSize = size();
-    if (oldSize == oldCapacity) {
-        reserve((0 == oldCapacity) ? 1 : std::ceil(RESERVE_COEFF * capacity()));
+    emplace_back(std::move(element));
+}
+
+/// On growth the element is built before the buffer moves, so arguments
+/// that refer into this Vector stay valid.
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+void
+Vector<T, Alloc, Growth>::emplace_back(Args&&... args)
+{
+    if (end_ == bufferEnd_) {
+        T value(std::forward<Args>(args)...);
+        reserve(nextCapacity(size() + 1));
+        new (end_) T(std::move(value));
+        ++end_;
+        return;
     }
-    *(end_++) = element;
+    new (end_) T(std::forward<Args>(args)...);
+    ++end_;
 }
+#endif
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 void
-Vector<T>::pop_back()
+Vector<T, Alloc, Growth>::pop_back()
 {
-    (end_--)->~T();
+    (--end_)->~T();
+    shrinkIfSparse();
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 void
-Vector<T>::clear()
+Vector<T, Alloc, Growth>::clear()
 {
-    for (size_type i = 1 ; i < size(); ++i) {
-        (end_ - i)->~T();
-    }
+    Destroyer<T>::destroy(begin_, end_);
     end_ = begin_;
+    shrinkIfSparse();
 }
 
-template <typename T>
-typename Vector<T>::size_type
-Vector<T>::capacity() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::size_type
+Vector<T, Alloc, Growth>::capacity() const
 {
     return bufferEnd_ - begin_;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 void
-Vector<T>::reserve(const Vector::size_type n)
+Vector<T, Alloc, Growth>::reserve(const Vector::size_type n)
 {
     if (n <= capacity()) {
         return;
     }
-    T* temp = reinterpret_cast<T*>(::operator new[](n * sizeof(T)));
-    ::memcpy(reinterpret_cast<void*>(temp), reinterpret_cast<void*>(begin_), sizeof(T) * size());
-    size_type sizeTemp = size();
+    size_type allocated = n;
+    const size_type sizeTemp = size();
+    if (IsTriviallyRelocatable<T>::value && begin_ != NULL) {
+        T* moved = AllocatorTraits<Alloc>::reallocate(allocator_, begin_, capacity(), n, allocated);
+        if (moved != NULL) {
+            VECTOR_STATS_HOOK(Vector, grew(this, sizeTemp, capacity(), allocated, true));
+            begin_ = moved;
+            end_ = begin_ + sizeTemp;
+            bufferEnd_ = begin_ + allocated;
+            return;
+        }
+    }
+    T* temp = AllocatorTraits<Alloc>::allocateAtLeast(allocator_, n, allocated);
+    try {
+        Relocator<T>::relocate(temp, begin_, sizeTemp);
+    } catch (...) {
+        allocator_.deallocate(temp, allocated);
+        throw;
+    }
+    VECTOR_STATS_HOOK(Vector, grew(this, sizeTemp, capacity(), allocated, false));
 
     if (begin_ != NULL) {
-        delete[] begin_;
+        allocator_.deallocate(begin_, capacity());
         begin_ = NULL;
     }
     begin_ = temp;
     end_ = begin_ + sizeTemp;
-    bufferEnd_ = begin_ + n;
+    bufferEnd_ = begin_ + allocated;
 }
 
-template <typename T>
-typename Vector<T>::const_reference
-Vector<T>::operator[](const typename Vector<T>::size_type index) const
+/// Gives back the unused capacity when the allocator can hand out a
+/// smaller buffer; embedded buffers (SmallVector, StaticVector) are kept.
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::shrink_to_fit()
+{
+    if (size() < capacity()) {
+        shrinkTo(size());
+    }
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::operator[](const typename Vector<T, Alloc, Growth>::size_type index) const
 {
     //assert(index < size() && begin_ != NULL);
     return begin_[index];
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::operator==(const Vector<T>& rhv) const
+Vector<T, Alloc, Growth>::operator==(const Vector<T, Alloc, Growth>& rhv) const
 {
-    if (size() != rhv.size()) {
-        return false;
-    }
-    for (size_type i = 0; i < size(); ++i) {
-        if (this->operator[](i) != rhv[i]) {
-            return false;
-        }
-    }
-    return true;
+    return size() == rhv.size() && RangeCompare<T>::equal(begin_, rhv.begin_, size());
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::operator!=(const Vector<T>& rhv) const
+Vector<T, Alloc, Growth>::operator!=(const Vector<T, Alloc, Growth>& rhv) const
 {
     return !(this->operator==(rhv));
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::operator<(const Vector<T>& rhv) const
-{
-    if (this->operator==(rhv)) return false;
-    if (this->size() > rhv.size()) return false;
-    if (this->size() < rhv.size()) return true;
-    for (size_type i = 0; i < size(); ++i) {
-        if (begin_[i] > rhv.begin_[i]) {
-            return false;
-        }
-    }
-    return true;
+Vector<T, Alloc, Growth>::operator<(const Vector<T, Alloc, Growth>& rhv) const
+{
+    return RangeCompare<T>::less(begin_, size(), rhv.begin_, rhv.size());
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::operator<=(const Vector<T>& rhv) const
+Vector<T, Alloc, Growth>::operator<=(const Vector<T, Alloc, Growth>& rhv) const
 {
     return !(rhv < *this);
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::operator>(const Vector<T>& rhv) const
+Vector<T, Alloc, Growth>::operator>(const Vector<T, Alloc, Growth>& rhv) const
 {
     return rhv < *this;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::operator>=(const Vector<T>& rhv) const
+Vector<T, Alloc, Growth>::operator>=(const Vector<T, Alloc, Growth>& rhv) const
 {
     return !(*this < rhv);
 }
 
-template <typename T>
-typename Vector<T>::const_iterator
-Vector<T>::begin() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_iterator
+Vector<T, Alloc, Growth>::begin() const
 {
     return const_iterator(begin_);
 }
 
-template <typename T>
-typename Vector<T>::iterator
-Vector<T>::begin()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::begin()
 {
     return iterator(begin_);
 }
 
-template <typename T>
-typename Vector<T>::const_iterator
-Vector<T>::end() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_iterator
+Vector<T, Alloc, Growth>::end() const
 {
     return const_iterator(end_);
 }
 
-template <typename T>
-typename Vector<T>::iterator
-Vector<T>::end()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::end()
 {
     return iterator(end_);
 }
 
-template <typename T>
-typename Vector<T>::const_reverse_iterator
-Vector<T>::rbegin() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reverse_iterator
+Vector<T, Alloc, Growth>::rbegin() const
 {
     return const_reverse_iterator(end_ - 1);
 }
 
-template <typename T>
-typename Vector<T>::reverse_iterator
-Vector<T>::rbegin()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::reverse_iterator
+Vector<T, Alloc, Growth>::rbegin()
 {
     return reverse_iterator(end_ - 1);
 }
 
-template <typename T>
-typename Vector<T>::const_reverse_iterator
-Vector<T>::rend() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reverse_iterator
+Vector<T, Alloc, Growth>::rend() const
 {
     return const_reverse_iterator(begin_ - 1);
 }
 
-template <typename T>
-typename Vector<T>::reverse_iterator
-Vector<T>::rend()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::reverse_iterator
+Vector<T, Alloc, Growth>::rend()
 {
     return reverse_iterator(begin_ - 1);
 }
 
-template <typename T>
-typename Vector<T>::iterator
-Vector<T>::insert(iterator pos, const_reference x)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::insert(iterator pos, const_reference x)
 {
-    assert(pos >= begin_ && pos < end_);
+    assert(pos.getPtr() >= begin_ && pos.getPtr() <= end_);
     const size_type index = pos.getPtr() - begin_;
-    resize(size() + 1);
+    if (contains(&x)) {
+        const T copy(x);
+        return insert(pos, copy);
+    }
+    T* const gap = openGap(index, 1);
+    try {
+        new (gap) T(x);
+    } catch (...) {
+        closeGap(index, 1);
+        throw;
+    }
+    return iterator(gap);
+}
 
-    for (size_type i = size() - 1; i > index; --i) {
-        begin_[i] = begin_[i - 1];
+#if __cplusplus >= 201103L
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::insert(iterator pos, value_type&& x)
+{
+    return emplace(pos, std::move(x));
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::emplace(iterator pos, Args&&... args)
+{
+    assert(pos.getPtr() >= begin_ && pos.getPtr() <= end_);
+    const size_type index = pos.getPtr() - begin_;
+    T value(std::forward<Args>(args)...);
+    T* const gap = openGap(index, 1);
+    try {
+        new (gap) T(std::move(value));
+    } catch (...) {
+        closeGap(index, 1);
+        throw;
     }
-    *(begin_ + index) = x;
-    return begin_ + index;
+    return iterator(gap);
 }
+#endif
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 void
-Vector<T>::insert(iterator pos, const size_type n, const_reference x)
+Vector<T, Alloc, Growth>::insert(iterator pos, const size_type n, const_reference x)
 {
-    //assert(pos >= begin_ && pos + n < end_);
-    const size_type index = pos - begin_;
-    resize(size() + n);
-
-    for (size_type i = size() - 1; i > index; --i) {
-        begin_[i] = begin_[i - n];
+    assert(pos.getPtr() >= begin_ && pos.getPtr() <= end_);
+    const size_type index = pos.getPtr() - begin_;
+    if (contains(&x)) {
+        const T copy(x);
+        insert(pos, n, copy);
+        return;
     }
-    for (size_type i = 0; i < n; ++i) {
-        *(begin_ + index + i) = x;
+    T* const gap = openGap(index, n);
+    try {
+        Filler<T>::construct(gap, n, x);
+    } catch (...) {
+        closeGap(index, n);
+        throw;
     }
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::insert(iterator pos, const int n, const_reference x)
+{
+    assert(n >= 0);
+    insert(pos, static_cast<size_type>(n), x);
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename InputIterator>
 void
-Vector<T>::insert(iterator pos, const int n, const_reference x)
+Vector<T, Alloc, Growth>::insert(iterator pos, InputIterator f, InputIterator l)
 {
-//    assert(pos >= begin_ && pos + n < end_);
-    size_type index = pos.getPtr() - begin_;
-    resize(size() + n);
+    assert(pos.getPtr() >= begin_ && pos.getPtr() <= end_);
+    rangeInsert(pos.getPtr() - begin_, f, l, IsIntegral<InputIterator>());
+}
 
-    for (size_type i = size() - 1; i > index; --i) {
-        begin_[i] = begin_[i - n];
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::erase(iterator pos)
+{
+    iterator next = pos;
+    ++next;
+    return erase(pos, next);
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::erase(iterator f, iterator l)
+{
+    assert(f.getPtr() >= begin_ && f.getPtr() <= l.getPtr() && l.getPtr() <= end_);
+    const size_type index = f.getPtr() - begin_;
+    const size_type distance = l.getPtr() - f.getPtr();
+    Destroyer<T>::destroy(f.getPtr(), l.getPtr());
+    closeGap(index, distance);
+    shrinkIfSparse();
+    return iterator(begin_ + index);
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::size_type
+Vector<T, Alloc, Growth>::nextCapacity(const size_type required) const
+{
+    VECTOR_STATS_HOOK(Vector, implicitGrowth());
+    const size_type grown = Growth::grow(capacity(), required, sizeof(T));
+    return grown < required ? required : grown;
+}
+
+/// Moves the elements into a buffer of at least n (size() <= n < capacity())
+/// slots. Nothing changes when the allocator cannot provide a smaller one.
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::shrinkTo(const size_type n)
+{
+    assert(size() <= n && n < capacity());
+    const size_type sizeTemp = size();
+    size_type allocated = n;
+    if (IsTriviallyRelocatable<T>::value && n != 0) {
+        T* moved = AllocatorTraits<Alloc>::reallocate(allocator_, begin_, capacity(), n, allocated);
+        if (moved != NULL) {
+            VECTOR_STATS_HOOK(Vector, shrank());
+            begin_ = moved;
+            end_ = begin_ + sizeTemp;
+            bufferEnd_ = begin_ + allocated;
+            return;
+        }
+    }
+    if (!isTransferable()) {
+        return;
+    }
+    if (0 == n) {
+        VECTOR_STATS_HOOK(Vector, shrank());
+        allocator_.deallocate(begin_, capacity());
+        begin_ = NULL;
+        end_ = NULL;
+        bufferEnd_ = NULL;
+        return;
     }
-    for (int i = 0; i < n; ++i) {
-        *(begin_ + index + i) = x;
+    T* temp = AllocatorTraits<Alloc>::allocateAtLeast(allocator_, n, allocated);
+    if (allocated >= capacity()) {
+        allocator_.deallocate(temp, allocated);
+        return;
+    }
+    try {
+        Relocator<T>::relocate(temp, begin_, sizeTemp);
+    } catch (...) {
+        allocator_.deallocate(temp, allocated);
+        throw;
+    }
+    VECTOR_STATS_HOOK(Vector, shrank());
+    allocator_.deallocate(begin_, capacity());
+    begin_ = temp;
+    end_ = begin_ + sizeTemp;
+    bufferEnd_ = begin_ + allocated;
+}
+
+/// Applies the growth policy's shrinking after elements were removed. A
+/// failed shrink is not an error: the elements stay where they were.
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::shrinkIfSparse()
+{
+    const size_type target = Growth::shrink(capacity(), size(), sizeof(T));
+    if (target < capacity()) {
+        try {
+            shrinkTo(target < size() ? size() : target);
+        } catch (...) {
+        }
     }
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
+bool
+Vector<T, Alloc, Growth>::contains(const T* element) const
+{
+    return element >= begin_ && element < end_;
+}
+
+/// Shifts [index, size()) n slots to the right and returns the first slot of
+/// the resulting uninitialized gap. When the buffer has to grow, the
+/// elements are relocated once, straight to their places around the gap;
+/// only trivially relocatable ones go through reserve, which may extend the
+/// buffer in place. If a copy throws, the elements are left as they were.
+template <typename T, typename Alloc, typename Growth>
+T*
+Vector<T, Alloc, Growth>::openGap(const size_type index, const size_type n)
+{
+    const size_type oldSize = size();
+    if (oldSize + n > capacity()) {
+        if (IsTriviallyRelocatable<T>::value) {
+            reserve(nextCapacity(oldSize + n));
+        } else {
+            size_type allocated = 0;
+            T* temp = AllocatorTraits<Alloc>::allocateAtLeast(allocator_, nextCapacity(oldSize + n), allocated);
+            try {
+                Relocator<T>::relocateAround(temp, begin_, oldSize, index, n);
+            } catch (...) {
+                allocator_.deallocate(temp, allocated);
+                throw;
+            }
+            VECTOR_STATS_HOOK(Vector, grew(this, oldSize, capacity(), allocated, false));
+            if (begin_ != NULL) {
+                allocator_.deallocate(begin_, capacity());
+            }
+            begin_ = temp;
+            end_ = begin_ + oldSize + n;
+            bufferEnd_ = begin_ + allocated;
+            return begin_ + index;
+        }
+    }
+    Relocator<T>::relocateBackward(begin_ + index + n, begin_ + index, oldSize - index);
+    VECTOR_STATS_HOOK(Vector, shifted(oldSize - index));
+    end_ += n;
+    return begin_ + index;
+}
+
+/// Range insertion is dispatched on the iterator: a pair of integers means
+/// "n copies of value", single-pass input ranges grow incrementally, and
+/// forward ranges are measured once, shifted once and built in place
+/// (with a bulk copy when the source is contiguous).
+template <typename T, typename Alloc, typename Growth>
+template <typename Integer>
+void
+Vector<T, Alloc, Growth>::rangeInsert(const size_type index, Integer n, Integer value, TrueType)
+{
+    insert(iterator(begin_ + index), static_cast<size_type>(n), static_cast<T>(value));
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename InputIterator>
+void
+Vector<T, Alloc, Growth>::rangeInsert(const size_type index, InputIterator f, InputIterator l, FalseType)
+{
+    rangeInsert(index, f, l, typename IteratorCategory<InputIterator>::type());
+}
+
+template <typename T, typename Alloc, typename Growth>
 template <typename InputIterator>
 void
-Vector<T>::insert(iterator pos, InputIterator f, InputIterator l)
+Vector<T, Alloc, Growth>::rangeInsert(const size_type index, InputIterator f, InputIterator l, std::input_iterator_tag)
 {
-    while (f != l) {
-        pos = insert(pos, *(f));
-        ++f;
-        ++pos;
+    if (index == size()) {
+        for (; f != l; ++f) {
+            push_back(*f);
+        }
+        return;
     }
+    Vector temp(allocator_);
+    for (; f != l; ++f) {
+        temp.push_back(*f);
+    }
+    contiguousInsert(index, temp.begin_, temp.end_);
 }
 
-template <typename T>
-typename Vector<T>::iterator
-Vector<T>::erase(iterator pos)
+template <typename T, typename Alloc, typename Growth>
+template <typename ForwardIterator>
+void
+Vector<T, Alloc, Growth>::rangeInsert(const size_type index, ForwardIterator f, ForwardIterator l, std::forward_iterator_tag)
 {
-    size_type index = pos.getPtr() - begin_;
-    for (size_type i = index; i < size() - 1; ++i) {
-        begin_[i] = begin_[i + 1];
+    const T* const source = contiguousAddress(f);
+    if (source != NULL) {
+        contiguousInsert(index, source, contiguousAddress(l));
+        return;
     }
-    resize(size() - 1);
-    return pos;
+    size_type n = 0;
+    for (ForwardIterator it = f; it != l; ++it) {
+        ++n;
+    }
+    T* const gap = openGap(index, n);
+    size_type built = 0;
+    try {
+        for (; built < n; ++built, ++f) {
+            new (gap + built) T(*f);
+        }
+    } catch (...) {
+        Destroyer<T>::destroy(gap, gap + built);
+        closeGap(index, n);
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::contiguousInsert(const size_type index, const T* f, const T* l)
+{
+    if (f == l) {
+        return;
+    }
+    if (contains(f)) {
+        const Vector temp(f, l, allocator_);
+        contiguousInsert(index, temp.begin_, temp.end_);
+        return;
+    }
+    const size_type n = l - f;
+    T* const gap = openGap(index, n);
+    try {
+        Copier<T>::construct(gap, f, n);
+    } catch (...) {
+        closeGap(index, n);
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename Iterator>
+const T*
+Vector<T, Alloc, Growth>::contiguousAddress(const Iterator&)
+{
+    return NULL;
+}
+
+template <typename T, typename Alloc, typename Growth>
+const T*
+Vector<T, Alloc, Growth>::contiguousAddress(const const_iterator& it)
+{
+    return it.getPtr();
+}
+
+template <typename T, typename Alloc, typename Growth>
+const T*
+Vector<T, Alloc, Growth>::contiguousAddress(const iterator& it)
+{
+    return it.getPtr();
+}
+
+template <typename T, typename Alloc, typename Growth>
+const T*
+Vector<T, Alloc, Growth>::contiguousAddress(const T* it)
+{
+    return it;
+}
+
+template <typename T, typename Alloc, typename Growth>
+const T*
+Vector<T, Alloc, Growth>::contiguousAddress(T* it)
+{
+    return it;
 }
 
-template<typename T>
-typename Vector<T>::iterator
-Vector<T>::erase(iterator f, iterator l)
+template <typename T, typename Alloc, typename Growth>
+bool
+Vector<T, Alloc, Growth>::isTransferable() const
+{
+    return NULL == begin_ || AllocatorTraits<Alloc>::isTransferable(allocator_, begin_);
+}
+
+/// Moves every element of rhv to the end of this (empty) Vector one by one,
+/// for buffers that cannot simply change owner.
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::relocateFrom(Vector& rhv)
 {
-    const size_type distance = l - f;
-    const size_type index = end_ - l.getPtr() - 1;
-    const size_type tempSize = size();
-    for (size_type i = tempSize - index - 1; i < tempSize; ++i) {
-        begin_[i - distance] = begin_[i];
+    assert(0 == size());
+    const size_type n = rhv.size();
+    reserve(n);
+    Relocator<T>::relocate(begin_, rhv.begin_, n);
+    end_ = begin_ + n;
+    rhv.end_ = rhv.begin_;
+}
+
+/// Leaves rhv empty and this (which must be empty) with its elements,
+/// stealing rhv's buffer whenever it may change owner.
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::takeFrom(Vector& rhv)
+{
+    if (NULL == rhv.begin_ || !rhv.isTransferable()) {
+        relocateFrom(rhv);
+        return;
     }
-    resize(tempSize - distance);
-    return l;
+    assert(0 == size());
+    if (begin_ != NULL) {
+        allocator_.deallocate(begin_, capacity());
+    }
+    begin_ = rhv.begin_;
+    end_ = rhv.end_;
+    bufferEnd_ = rhv.bufferEnd_;
+    rhv.begin_ = NULL;
+    rhv.end_ = NULL;
+    rhv.bufferEnd_ = NULL;
+}
+
+/// Inverse of openGap: [index, index + n) must hold no live elements. If a
+/// copy throws, the elements past the gap are destroyed as well, so the
+/// Vector ends at index and never holds a dead slot.
+template <typename T, typename Alloc, typename Growth>
+void
+Vector<T, Alloc, Growth>::closeGap(const size_type index, const size_type n)
+{
+    try {
+        Relocator<T>::relocateForward(begin_ + index, begin_ + index + n, size() - index - n);
+    } catch (...) {
+        Destroyer<T>::destroy(begin_ + index + n, end_);
+        end_ = begin_ + index;
+        throw;
+    }
+    VECTOR_STATS_HOOK(Vector, shifted(size() - index - n));
+    end_ -= n;
 }
 
-template <typename T>
-Vector<T>::const_iterator::const_iterator()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::const_iterator::const_iterator()
     : ptr_(NULL)
 {
 }
 
-template <typename T>
-Vector<T>::const_iterator::const_iterator(const const_iterator& rhv)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::const_iterator::const_iterator(const const_iterator& rhv)
     : ptr_(rhv.ptr_)
 {
 }
 
-template <typename T>
-Vector<T>::const_iterator::const_iterator(pointer rhv)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::const_iterator::const_iterator(pointer rhv)
     : ptr_(rhv)
 {}
 
-template <typename T>
-Vector<T>::const_iterator::~const_iterator()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::const_iterator::~const_iterator()
 {
     if (ptr_ != NULL) {
         ptr_ = NULL;
     }
 }
 
-template <typename T>
-typename Vector<T>::pointer
-Vector<T>::const_iterator::getPtr() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::pointer
+Vector<T, Alloc, Growth>::const_iterator::getPtr() const
 {
     return ptr_;
 }
 
-template <typename T>
-typename Vector<T>::pointer
-Vector<T>::const_iterator::getPtr()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::pointer
+Vector<T, Alloc, Growth>::const_iterator::getPtr()
 {
     return ptr_;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 void
-Vector<T>::const_iterator::setPtr(const pointer ptr)
+Vector<T, Alloc, Growth>::const_iterator::setPtr(const pointer ptr)
 {
     if (NULL == ptr) return;
     ptr_ = ptr;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator&
-Vector<T>::const_iterator::operator=(const const_iterator& rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator&
+Vector<T, Alloc, Growth>::const_iterator::operator=(const const_iterator& rhv)
 {
     ptr_ = rhv.ptr_;
     return *this;
 }
 
-template <typename T>
-typename Vector<T>::const_reference
-Vector<T>::const_iterator::operator*() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::const_iterator::operator*() const
 {
     return *ptr_;
 }
 
-template <typename T>
-const typename Vector<T>::value_type*
-Vector<T>::const_iterator::operator->() const
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::value_type*
+Vector<T, Alloc, Growth>::const_iterator::operator->() const
 {
     return ptr_;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator&
-Vector<T>::const_iterator::operator++()
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator&
+Vector<T, Alloc, Growth>::const_iterator::operator++()
 {
     ++ptr_;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator
-Vector<T>::const_iterator::operator++(int)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator
+Vector<T, Alloc, Growth>::const_iterator::operator++(int)
 {
     const_iterator temp = *this;
     ++ptr_;
     return temp;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator&
-Vector<T>::const_iterator::operator--()
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator&
+Vector<T, Alloc, Growth>::const_iterator::operator--()
 {
     --ptr_;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator
-Vector<T>::const_iterator::operator--(int)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator
+Vector<T, Alloc, Growth>::const_iterator::operator--(int)
 {
     const_iterator temp = *this;
     --ptr_;
     return temp;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator&
-Vector<T>::const_iterator::operator+=(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator&
+Vector<T, Alloc, Growth>::const_iterator::operator+=(const int rhv)
 {
     ptr_ += rhv;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator&
-Vector<T>::const_iterator::operator-=(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator&
+Vector<T, Alloc, Growth>::const_iterator::operator-=(const int rhv)
 {
     ptr_ -= rhv;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator&
-Vector<T>::const_iterator::operator+(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator&
+Vector<T, Alloc, Growth>::const_iterator::operator+(const int rhv)
 {
     ptr_ = ptr_ + rhv;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_iterator&
-Vector<T>::const_iterator::operator-(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_iterator&
+Vector<T, Alloc, Growth>::const_iterator::operator-(const int rhv)
 {
     ptr_ = ptr_ - rhv;
     return *this;
 }
 
-template <typename T>
-typename Vector<T>::difference_type
-Vector<T>::const_iterator::operator-(const const_iterator& rhv) const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::difference_type
+Vector<T, Alloc, Growth>::const_iterator::operator-(const const_iterator& rhv) const
 {
     return ptr_ - rhv.ptr_;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::const_iterator::operator==(const Vector::const_iterator& rhv) const
+Vector<T, Alloc, Growth>::const_iterator::operator==(const Vector::const_iterator& rhv) const
 {
     return getPtr() == rhv.getPtr();
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::const_iterator::operator!=(const Vector::const_iterator& rhv) const
+Vector<T, Alloc, Growth>::const_iterator::operator!=(const Vector::const_iterator& rhv) const
 {
     return !(*this == rhv);
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::const_iterator::operator<(const Vector::const_iterator& rhv) const
+Vector<T, Alloc, Growth>::const_iterator::operator<(const Vector::const_iterator& rhv) const
 {
     return ptr_ < rhv.ptr_;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::const_iterator::operator<=(const Vector::const_iterator& rhv) const
+Vector<T, Alloc, Growth>::const_iterator::operator<=(const Vector::const_iterator& rhv) const
 {
     return ptr_ <= rhv.ptr_;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::const_iterator::operator>(const Vector::const_iterator& rhv) const
+Vector<T, Alloc, Growth>::const_iterator::operator>(const Vector::const_iterator& rhv) const
 {
     return ptr_ > rhv.ptr_;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::const_iterator::operator>=(const Vector::const_iterator& rhv) const
+Vector<T, Alloc, Growth>::const_iterator::operator>=(const Vector::const_iterator& rhv) const
 {
     return ptr_ >= rhv.ptr_;
 }
 
-template <typename T>
-typename Vector<T>::const_reference
-Vector<T>::const_iterator::operator[](const size_type size) const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::const_iterator::operator[](const size_type size) const
 {
     return *(ptr_ + size);
 }
 
-template <typename T>
-Vector<T>::iterator::iterator()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::iterator::iterator()
         : const_iterator()
 {
 }
 
-template <typename T>
-Vector<T>::iterator::iterator(const iterator& rhv)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::iterator::iterator(const iterator& rhv)
     : const_iterator(rhv)
 {
 }
 
-template <typename T>
-Vector<T>::iterator::iterator(pointer rhv)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::iterator::iterator(pointer rhv)
     : const_iterator(rhv)
 {
 }
 
-template <typename T>
-Vector<T>::iterator::~iterator()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::iterator::~iterator()
 {
 }
 
-template<typename T>
-typename Vector<T>::difference_type
-Vector<T>::iterator::operator-(iterator& rhv) const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::difference_type
+Vector<T, Alloc, Growth>::iterator::operator-(iterator& rhv) const
 {
     return const_iterator::getPtr() - rhv.getPtr();
 }
 
-template <typename T>
-typename Vector<T>::reference
-Vector<T>::iterator::operator*()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::reference
+Vector<T, Alloc, Growth>::iterator::operator*()
 {
-    return *(::Vector<T>::const_iterator::getPtr());
+    return *(::Vector<T, Alloc, Growth>::const_iterator::getPtr());
 }
 
-template <typename T>
-typename Vector<T>::iterator&
-Vector<T>::iterator::operator++()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator&
+Vector<T, Alloc, Growth>::iterator::operator++()
 {
     pointer ptr = const_iterator::getPtr();
     ++ptr;
@@ -614,9 +1102,9 @@ Vector<T>::iterator::operator++()
     return *this;
 }
 
-template <typename T>
-typename Vector<T>::iterator
-Vector<T>::iterator::operator++(int)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::iterator::operator++(int)
 {
     iterator temp = *this;
     pointer ptr = const_iterator::getPtr();
@@ -625,9 +1113,9 @@ Vector<T>::iterator::operator++(int)
     return temp;
 }
 
-template <typename T>
-typename Vector<T>::iterator&
-Vector<T>::iterator::operator--()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator&
+Vector<T, Alloc, Growth>::iterator::operator--()
 {
     pointer ptr = const_iterator::getPtr();
     --ptr;
@@ -635,9 +1123,9 @@ Vector<T>::iterator::operator--()
     return *this;
 }
 
-template <typename T>
-typename Vector<T>::iterator
-Vector<T>::iterator::operator--(int)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator
+Vector<T, Alloc, Growth>::iterator::operator--(int)
 {
     iterator temp = *this;
     pointer ptr = const_iterator::getPtr();
@@ -646,266 +1134,282 @@ Vector<T>::iterator::operator--(int)
     return temp;
 }
 
-template <typename T>
-typename Vector<T>::iterator&
-Vector<T>::iterator::operator+(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator&
+Vector<T, Alloc, Growth>::iterator::operator+(const int rhv)
 {
     const_iterator::setPtr(const_iterator::getPtr() + rhv);
     return *this;
 }
 
-template <typename T>
-typename Vector<T>::iterator&
-Vector<T>::iterator::operator-(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator&
+Vector<T, Alloc, Growth>::iterator::operator-(const int rhv)
 {
     const_iterator::setPtr(const_iterator::getPtr() - rhv);
     return *this;
 }
 
 
-template <typename T>
-typename Vector<T>::const_reference
-Vector<T>::iterator::operator->()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::iterator::operator->()
 {
     return const_iterator::getPtr();
 }
 
-template <typename T>
-typename Vector<T>::reference
-Vector<T>::iterator::operator[](const size_type size)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::reference
+Vector<T, Alloc, Growth>::iterator::operator[](const size_type size)
 {
     return *(const_iterator::getPtr() + size);
 }
 
-template <typename T>
-typename Vector<T>::iterator&
-Vector<T>::iterator::operator=(const const_iterator& rhv)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator&
+Vector<T, Alloc, Growth>::iterator::operator=(const iterator& rhv)
+{
+    const_iterator::operator=(rhv);
+    return *this;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::iterator&
+Vector<T, Alloc, Growth>::iterator::operator=(const const_iterator& rhv)
 {
     const_iterator::setPtr(rhv.getPtr());
     return *this;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::iterator::operator==(const Vector::iterator& rhv)
+Vector<T, Alloc, Growth>::iterator::operator==(const Vector::iterator& rhv)
 {
     return const_iterator::getPtr() == rhv.getPtr();
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::iterator::operator!=(const Vector::iterator& rhv)
+Vector<T, Alloc, Growth>::iterator::operator!=(const Vector::iterator& rhv)
 {
     return !(*this == rhv);
 }
 
-template <typename T>
-Vector<T>::const_reverse_iterator::const_reverse_iterator()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::const_reverse_iterator::const_reverse_iterator()
     :ptr_(NULL)
 {}
 
-template <typename T>
-Vector<T>::const_reverse_iterator::const_reverse_iterator(const Vector::const_reverse_iterator&rhv)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::const_reverse_iterator::const_reverse_iterator(const Vector::const_reverse_iterator&rhv)
 {
     ptr_ = rhv.ptr_;
 }
 
-template <typename T>
-Vector<T>::const_reverse_iterator::const_reverse_iterator(pointer rhv)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::const_reverse_iterator::const_reverse_iterator(pointer rhv)
     : ptr_(rhv)
 {}
 
-template <typename T>
-Vector<T>::const_reverse_iterator::~const_reverse_iterator()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::const_reverse_iterator::~const_reverse_iterator()
 {
     if (ptr_ != NULL) {
         ptr_ = NULL;
     }
 }
 
-template <typename T>
-typename Vector<T>::pointer
-Vector<T>::const_reverse_iterator::getPtr() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::pointer
+Vector<T, Alloc, Growth>::const_reverse_iterator::getPtr() const
 {
     return ptr_;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 void
-Vector<T>::const_reverse_iterator::setPtr(const typename Vector<T>::pointer ptr)
+Vector<T, Alloc, Growth>::const_reverse_iterator::setPtr(const typename Vector<T, Alloc, Growth>::pointer ptr)
 {
     if (ptr == NULL) return;
     ptr_ = ptr;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator&
-Vector<T>::const_reverse_iterator::operator=(const const_reverse_iterator& rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator&
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator=(const const_reverse_iterator& rhv)
 {
     ptr_ = rhv.ptr_;
     return *this;
 }
 
-template <typename T>
-typename Vector<T>::const_reference
-Vector<T>::const_reverse_iterator::operator*() const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator*() const
 {
     return *ptr_;
 }
 
-template <typename T>
-const typename Vector<T>::value_type*
-Vector<T>::const_reverse_iterator::operator->() const
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::value_type*
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator->() const
 {
     return ptr_;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator&
-Vector<T>::const_reverse_iterator::operator++()
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator&
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator++()
 {
     --ptr_;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator
-Vector<T>::const_reverse_iterator::operator++(int)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator++(int)
 {
     const_reverse_iterator temp = *this;
     --ptr_;
     return temp;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator&
-Vector<T>::const_reverse_iterator::operator--()
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator&
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator--()
 {
     ++ptr_;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator
-Vector<T>::const_reverse_iterator::operator--(int)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator--(int)
 {
     const_reverse_iterator temp = *this;
     ++ptr_;
     return temp;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator&
-Vector<T>::const_reverse_iterator::operator+=(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator&
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator+=(const int rhv)
 {
     ptr_ -= rhv;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator&
-Vector<T>::const_reverse_iterator::operator-=(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator&
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator-=(const int rhv)
 {
     ptr_ += rhv;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator&
-Vector<T>::const_reverse_iterator::operator+(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator&
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator+(const int rhv)
 {
     ptr_ = ptr_ - rhv;
     return *this;
 }
 
-template <typename T>
-const typename Vector<T>::const_reverse_iterator&
-Vector<T>::const_reverse_iterator::operator-(const int rhv)
+template <typename T, typename Alloc, typename Growth>
+const typename Vector<T, Alloc, Growth>::const_reverse_iterator&
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator-(const int rhv)
 {
     ptr_ = ptr_ + rhv;
     return *this;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::const_reverse_iterator::operator==(const Vector::const_reverse_iterator& rhv)
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator==(const Vector::const_reverse_iterator& rhv)
 {
     return getPtr() == rhv.getPtr();
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::const_reverse_iterator::operator!=(const Vector::const_reverse_iterator& rhv)
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator!=(const Vector::const_reverse_iterator& rhv)
 {
     return !(*this == rhv);
 }
 
 
-template <typename T>
-typename Vector<T>::const_reference
-Vector<T>::const_reverse_iterator::operator[](const size_type size) const
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::const_reverse_iterator::operator[](const size_type size) const
 {
     return *(ptr_ + size);
 }
 
-template <typename T>
-Vector<T>::reverse_iterator::reverse_iterator()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::reverse_iterator::reverse_iterator()
     : const_reverse_iterator()
 {}
 
-template <typename T>
-Vector<T>::reverse_iterator::reverse_iterator(const reverse_iterator& rhv)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::reverse_iterator::reverse_iterator(const reverse_iterator& rhv)
     : const_reverse_iterator(rhv)
 {}
 
-template <typename T>
-Vector<T>::reverse_iterator::reverse_iterator(pointer rhv)
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::reverse_iterator::reverse_iterator(pointer rhv)
     : const_reverse_iterator(rhv)
 {}
 
-template <typename T>
-Vector<T>::reverse_iterator::~reverse_iterator()
+template <typename T, typename Alloc, typename Growth>
+Vector<T, Alloc, Growth>::reverse_iterator::~reverse_iterator()
 {}
 
-template <typename T>
-typename Vector<T>::reference
-Vector<T>::reverse_iterator::operator*()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::reference
+Vector<T, Alloc, Growth>::reverse_iterator::operator*()
 {
-    return *(::Vector<T>::const_reverse_iterator::getPtr());
+    return *(::Vector<T, Alloc, Growth>::const_reverse_iterator::getPtr());
 }
 
-template <typename T>
-typename Vector<T>::const_reference
-Vector<T>::reverse_iterator::operator->()
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::reverse_iterator::operator->()
 {
     return const_reverse_iterator::getPtr();
 }
 
-template <typename T>
-typename Vector<T>::reference
-Vector<T>::reverse_iterator::operator[](const size_type size)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::reference
+Vector<T, Alloc, Growth>::reverse_iterator::operator[](const size_type size)
 {
     return *(const_reverse_iterator::getPtr() + size);
 }
 
-template <typename T>
-typename Vector<T>::reverse_iterator&
-Vector<T>::reverse_iterator::operator=(const const_reverse_iterator& rhv)
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::reverse_iterator&
+Vector<T, Alloc, Growth>::reverse_iterator::operator=(const reverse_iterator& rhv)
+{
+    const_reverse_iterator::operator=(rhv);
+    return *this;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename Vector<T, Alloc, Growth>::reverse_iterator&
+Vector<T, Alloc, Growth>::reverse_iterator::operator=(const const_reverse_iterator& rhv)
 {
     const_reverse_iterator::setPtr(rhv.getPtr());
     return *this;
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::reverse_iterator::operator==(const Vector::reverse_iterator& rhv)
+Vector<T, Alloc, Growth>::reverse_iterator::operator==(const Vector::reverse_iterator& rhv)
 {
     return const_reverse_iterator::getPtr() == rhv.getPtr();
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 bool
-Vector<T>::reverse_iterator::operator!=(const Vector::reverse_iterator& rhv)
+Vector<T, Alloc, Growth>::reverse_iterator::operator!=(const Vector::reverse_iterator& rhv)
 {
     return !(*this == rhv);
 }
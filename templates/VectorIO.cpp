@@ -0,0 +1,230 @@
+#ifndef __VECTOR_IO_CPP__
+#define __VECTOR_IO_CPP__
+
+#include "../headers/VectorIO.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+template <typename T, bool Arithmetic>
+void
+ByteOrder<T, Arithmetic>::fromForeign(T*, const std::size_t)
+{
+    throw std::runtime_error("VectorIO: foreign byte order for a non-arithmetic element type");
+}
+
+template <typename T>
+void
+ByteOrder<T, true>::fromForeign(T* data, const std::size_t n)
+{
+    BinaryIO::swapBytes(data, sizeof(T), n);
+}
+
+template <typename T>
+void
+BinaryCodec<T, true>::encodeHeader(char* bytes, const std::size_t count, const unsigned int flags)
+{
+    BinaryHeader(sizeof(T), count, flags).encode(bytes);
+}
+
+template <typename T>
+template <typename Source>
+void
+BinaryCodec<T, true>::readHeader(Source& source, BinaryHeader& header)
+{
+    char bytes[BinaryHeader::SIZE];
+    BinaryIO::read(source, bytes, sizeof(bytes));
+    header.decode(bytes);
+    if (header.elementSize != sizeof(T)) {
+        throw std::runtime_error("VectorIO: element size mismatch");
+    }
+}
+
+template <typename T>
+template <typename Source>
+unsigned long long
+BinaryCodec<T, true>::readChunkSize(Source& source, const BinaryHeader& header)
+{
+    unsigned long long n = 0;
+    BinaryIO::read(source, &n, sizeof(n));
+    if (header.swapped()) {
+        BinaryIO::swapBytes(&n, sizeof(n), 1);
+    }
+    return n;
+}
+
+template <typename T>
+template <typename Source>
+void
+BinaryCodec<T, true>::readElements(Source& source, T* data, const std::size_t n, const BinaryHeader& header)
+{
+    BinaryIO::read(source, data, n * sizeof(T));
+    if (header.swapped()) {
+        ByteOrder<T>::fromForeign(data, n);
+    }
+}
+
+/// Reads straight into storage made by resize_uninitialized; a plain
+/// stream is sized up front, a chunked one grows chunk by chunk, with the
+/// capacity following the growth policy so many small chunks cost
+/// amortized constant copying per element.
+template <typename T>
+template <typename Source, typename Alloc, typename Growth>
+void
+BinaryCodec<T, true>::readVector(Source& source, Vector<T, Alloc, Growth>& vector)
+{
+    BinaryHeader header;
+    readHeader(source, header);
+    vector.clear();
+    try {
+        if (0 == (header.flags & BinaryHeader::CHUNKED)) {
+            if (header.count > vector.max_size()) {
+                throw std::runtime_error("VectorIO: element count too large");
+            }
+            const std::size_t n = static_cast<std::size_t>(header.count);
+            vector.resize_uninitialized(n);
+            if (n != 0) {
+                readElements(source, &*vector.begin(), n, header);
+            }
+            return;
+        }
+        for (unsigned long long n = readChunkSize(source, header); n != 0; n = readChunkSize(source, header)) {
+            const std::size_t old = vector.size();
+            if (n > vector.max_size() - old) {
+                throw std::runtime_error("VectorIO: element count too large");
+            }
+            const std::size_t required = old + static_cast<std::size_t>(n);
+            if (required > vector.capacity()) {
+                vector.reserve(std::max(required, Growth::grow(vector.capacity(), required, sizeof(T))));
+            }
+            vector.resize_uninitialized(required);
+            readElements(source, &*vector.begin() + old, static_cast<std::size_t>(n), header);
+        }
+    } catch (...) {
+        vector.clear();
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+writeBinary(std::ostream& out, const Vector<T, Alloc, Growth>& vector)
+{
+    char header[BinaryHeader::SIZE];
+    BinaryCodec<T>::encodeHeader(header, vector.size());
+    BinaryIO::write(out, header, sizeof(header));
+    if (vector.size() != 0) {
+        BinaryIO::write(out, &*vector.begin(), vector.size() * sizeof(T));
+    }
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+readBinary(std::istream& in, Vector<T, Alloc, Growth>& vector)
+{
+    BinaryCodec<T>::readVector(in, vector);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+writeBinary(const int fd, const Vector<T, Alloc, Growth>& vector)
+{
+    char header[BinaryHeader::SIZE];
+    BinaryCodec<T>::encodeHeader(header, vector.size());
+    const void* data = (0 == vector.size()) ? NULL : &*vector.begin();
+    BinaryIO::write(fd, header, sizeof(header), data, vector.size() * sizeof(T));
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+readBinary(const int fd, Vector<T, Alloc, Growth>& vector)
+{
+    BinaryCodec<T>::readVector(fd, vector);
+}
+
+template <typename T>
+BinaryChunkWriter<T>::BinaryChunkWriter(std::ostream& out)
+    : out_(out)
+    , finished_(false)
+{
+    char header[BinaryHeader::SIZE];
+    BinaryCodec<T>::encodeHeader(header, 0, BinaryHeader::CHUNKED);
+    BinaryIO::write(out_, header, sizeof(header));
+}
+
+template <typename T>
+void
+BinaryChunkWriter<T>::write(const T* data, const std::size_t n)
+{
+    if (0 == n) {
+        return;
+    }
+    const unsigned long long count = n;
+    BinaryIO::write(out_, &count, sizeof(count));
+    BinaryIO::write(out_, data, n * sizeof(T));
+}
+
+template <typename T>
+template <typename Alloc, typename Growth>
+void
+BinaryChunkWriter<T>::write(const Vector<T, Alloc, Growth>& chunk)
+{
+    if (chunk.size() != 0) {
+        write(&*chunk.begin(), chunk.size());
+    }
+}
+
+template <typename T>
+void
+BinaryChunkWriter<T>::finish()
+{
+    if (finished_) {
+        return;
+    }
+    const unsigned long long count = 0;
+    BinaryIO::write(out_, &count, sizeof(count));
+    out_.flush();
+    finished_ = true;
+}
+
+template <typename T>
+BinaryChunkReader<T>::BinaryChunkReader(std::istream& in, const std::size_t maxChunk)
+    : in_(in)
+    , header_()
+    , maxChunk_(0 == maxChunk ? 1 : maxChunk)
+    , remaining_(0)
+    , done_(false)
+{
+    BinaryCodec<T>::readHeader(in_, header_);
+    remaining_ = (header_.flags & BinaryHeader::CHUNKED) ? 0 : header_.count;
+}
+
+template <typename T>
+bool
+BinaryChunkReader<T>::nextChunk()
+{
+    if (0 == (header_.flags & BinaryHeader::CHUNKED)) {
+        return false;
+    }
+    remaining_ = BinaryCodec<T>::readChunkSize(in_, header_);
+    return remaining_ != 0;
+}
+
+template <typename T>
+template <typename Alloc, typename Growth>
+bool
+BinaryChunkReader<T>::read(Vector<T, Alloc, Growth>& chunk)
+{
+    chunk.clear();
+    if (done_ || (0 == remaining_ && !nextChunk())) {
+        done_ = true;
+        return false;
+    }
+    const std::size_t n = (remaining_ < maxChunk_) ? static_cast<std::size_t>(remaining_) : maxChunk_;
+    chunk.resize_uninitialized(n);
+    BinaryCodec<T>::readElements(in_, &*chunk.begin(), n, header_);
+    remaining_ -= n;
+    return true;
+}
+
+#endif /// __VECTOR_IO_CPP__
@@ -0,0 +1,95 @@
+#ifndef __VECTOR_STATS_CPP__
+#define __VECTOR_STATS_CPP__
+
+#include "../headers/VectorStats.hpp"
+
+#include <typeinfo>
+
+template <typename V>
+const VectorStatsCounters&
+VectorStats::of()
+{
+    return VectorStatsHooks<V>::counters();
+}
+
+/// Zero-initialized storage, enrolled in the registry on first use.
+template <typename V>
+VectorStatsCounters&
+VectorStatsHooks<V>::counters()
+{
+    static VectorStatsCounters counters;
+    static const bool enrolled = VectorStats::enroll(&counters, typeid(V).name(), sizeof(value_type));
+    static_cast<void>(enrolled);
+    return counters;
+}
+
+template <typename V>
+void
+VectorStatsHooks<V>::grew(const V* vector, const size_type size, const size_type oldCapacity,
+                          const size_type newCapacity, const bool inPlace)
+{
+    VectorStatsCounters& stats = counters();
+    VectorStats::add(stats.growths, 1);
+    if (inPlace) {
+        VectorStats::add(stats.reallocations, 1);
+    } else {
+        VectorStats::add(stats.allocations, 1);
+        VectorStats::add(stats.bytesRelocated, size * sizeof(value_type));
+    }
+    VectorGrowthEvent event;
+    event.stats = &stats;
+    event.vector = vector;
+    event.size = size;
+    event.oldCapacity = oldCapacity;
+    event.newCapacity = newCapacity;
+    event.inPlace = inPlace;
+    VectorStats::notify(event);
+}
+
+template <typename V>
+void
+VectorStatsHooks<V>::implicitGrowth()
+{
+    VectorStats::add(counters().implicitGrowths, 1);
+}
+
+template <typename V>
+void
+VectorStatsHooks<V>::shrank()
+{
+    VectorStats::add(counters().shrinks, 1);
+}
+
+template <typename V>
+void
+VectorStatsHooks<V>::copied(const size_type n)
+{
+    VectorStats::add(counters().bytesCopied, n * sizeof(value_type));
+}
+
+template <typename V>
+void
+VectorStatsHooks<V>::shifted(const size_type n)
+{
+    VectorStats::add(counters().elementsShifted, n);
+}
+
+template <typename V>
+void
+VectorStatsHooks<V>::resized()
+{
+    VectorStats::add(counters().resizes, 1);
+}
+
+template <typename V>
+void
+VectorStatsHooks<V>::destroyed(const size_type size, const size_type capacity)
+{
+    VectorStatsCounters& stats = counters();
+    VectorStats::add(stats.destroyed, 1);
+    VectorStats::add(stats.wastedBytes, (capacity - size) * sizeof(value_type));
+    VectorStats::add(stats.sizeHistogram[VectorStats::sizeBucket(size)], 1);
+    VectorStats::add(stats.fillHistogram[0 == capacity ? 0 : size * 10 / capacity], 1);
+}
+
+#endif /// __VECTOR_STATS_CPP__
@@ -0,0 +1,141 @@
+#ifndef __VECTOR_TEXT_CPP__
+#define __VECTOR_TEXT_CPP__
+
+#include "../headers/VectorText.hpp"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+template <typename T>
+void
+TextCodec<T, true, false>::write(TextWriter& writer, const T value)
+{
+    if (std::numeric_limits<T>::is_signed) {
+        writer.writeInteger(static_cast<long long>(value));
+    } else {
+        writer.writeInteger(static_cast<unsigned long long>(value));
+    }
+}
+
+template <typename T>
+const char*
+TextCodec<T, true, false>::parse(const char* first, const char* last, T& value)
+{
+    const char* end = NULL;
+    if (std::numeric_limits<T>::is_signed) {
+        long long wide = 0;
+        end = TextReader::parseInteger(first, last, wide);
+        if (NULL == end || wide < static_cast<long long>(std::numeric_limits<T>::min())
+                        || wide > static_cast<long long>(std::numeric_limits<T>::max())) {
+            return NULL;
+        }
+        value = static_cast<T>(wide);
+    } else {
+        unsigned long long wide = 0;
+        end = TextReader::parseInteger(first, last, wide);
+        if (NULL == end || wide > static_cast<unsigned long long>(std::numeric_limits<T>::max())) {
+            return NULL;
+        }
+        value = static_cast<T>(wide);
+    }
+    return end;
+}
+
+/// long double goes through double, which is what the parser reads back.
+template <typename T>
+void
+TextCodec<T, false, true>::write(TextWriter& writer, const T value)
+{
+    if (sizeof(T) == sizeof(float)) {
+        writer.writeFloat(static_cast<float>(value));
+    } else {
+        writer.writeFloat(static_cast<double>(value));
+    }
+}
+
+template <typename T>
+const char*
+TextCodec<T, false, true>::parse(const char* first, const char* last, T& value)
+{
+    if (sizeof(T) == sizeof(float)) {
+        float narrow = 0;
+        const char* end = TextReader::parseFloat(first, last, narrow);
+        value = narrow;
+        return end;
+    }
+    double wide = 0;
+    const char* end = TextReader::parseFloat(first, last, wide);
+    value = static_cast<T>(wide);
+    return end;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void
+writeText(std::ostream& out, const Vector<T, Alloc, Growth>& vector, const char separator)
+{
+    TextWriter writer(out);
+    for (std::size_t i = 0; i < vector.size(); ++i) {
+        if (i != 0) {
+            writer.write(separator);
+        }
+        TextCodec<T>::write(writer, vector[i]);
+    }
+    writer.write('\n');
+    writer.flush();
+}
+
+template <typename T, typename Alloc, typename Growth>
+std::size_t
+parseText(const char* first, const char* last, Vector<T, Alloc, Growth>& vector)
+{
+    std::size_t count = 0;
+    for (first = TextReader::skipSeparators(first, last); first != last; first = TextReader::skipSeparators(first, last)) {
+        T value;
+        const char* end = TextCodec<T>::parse(first, last, value);
+        if (NULL == end || (end != last && !TextReader::isSeparator(*end))) {
+            const char* stop = first;
+            while (stop != last && !TextReader::isSeparator(*stop) && stop - first < 32) {
+                ++stop;
+            }
+            throw std::runtime_error("VectorText: malformed value '" + std::string(first, stop) + "'");
+        }
+        vector.push_back(value);
+        first = end;
+        ++count;
+    }
+    return count;
+}
+
+/// A value cut by the end of a block is carried over to the next one.
+template <typename T, typename Alloc, typename Growth>
+std::size_t
+readText(std::istream& in, Vector<T, Alloc, Growth>& vector)
+{
+    Vector<char> block(TextReader::BUFFER_SIZE);
+    char* const data = &*block.begin();
+    std::size_t carried = 0;
+    std::size_t count = 0;
+    while (in) {
+        in.read(data + carried, static_cast<std::streamsize>(TextReader::BUFFER_SIZE - carried));
+        const std::size_t filled = carried + static_cast<std::size_t>(in.gcount());
+        if (!in) {
+            count += parseText(data, data + filled, vector);
+            break;
+        }
+        std::size_t cut = filled;
+        while (cut != 0 && !TextReader::isSeparator(data[cut - 1])) {
+            --cut;
+        }
+        if (0 == cut) {
+            throw std::runtime_error("VectorText: value longer than a block");
+        }
+        count += parseText(data, data + cut, vector);
+        carried = filled - cut;
+        ::memmove(data, data + cut, carried);
+    }
+    return count;
+}
+
+#endif /// __VECTOR_TEXT_CPP__